@@ -0,0 +1,207 @@
+#include "AIC.h"
+
+#include "Bitboard.h"
+#include "Candidates.h"
+#include "LinkGraph.h"
+
+#include "Board/Board.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+bool AIC::exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason)
+{
+    // For each candidate, assume that it is false and follow the chains of alternating strong and weak links from it, starting with a
+    // strong link. Every candidate reached by a strong link must then be true, so either the first candidate or that one is true,
+    // and any candidate that conflicts with both of them can be eliminated.
+
+    for (int i = 0; i < Board::NUM_CELLS; ++i)
+    {
+        for (int v = 1; v <= Board::SIZE; ++v)
+        {
+            if (!links_.cells(v).test(i))
+                continue;
+
+            // The first link must be a strong link
+            if (links_.strong(i, v).empty() && !links_.bivalues().test(i))
+                continue;
+
+            int root = node(i, v);
+            int last = search(root, indexes, values);
+            if (last >= 0)
+            {
+                reason = generateReason(root, last, indexes, values);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+int AIC::search(int root, std::vector<int> & indexes, std::vector<int> & values)
+{
+    for (auto & state : visited_)
+    {
+        for (auto & cells : state)
+        {
+            cells = Bitboard();
+        }
+    }
+    visited_[OFF][valueOf(root) - 1].set(cellOf(root));
+
+    std::vector<int> current = { root };
+    std::vector<int> next;
+    for (int length = 1; length <= MAX_LENGTH && !current.empty(); ++length)
+    {
+        // Odd links are strong links from a false candidate to a true one, and even links are weak links from a true candidate to a
+        // false one
+        bool strong = (length % 2) != 0;
+        next.clear();
+        for (int from : current)
+        {
+            int i = cellOf(from);
+            int v = valueOf(from);
+            if (strong)
+            {
+                for (Bitboard cells = links_.strong(i, v); !cells.empty();)
+                {
+                    visit(ON, cells.pop(), v, from, next);
+                }
+                if (links_.bivalues().test(i))
+                    visit(ON, i, Candidates::value(candidates_[i] & ~Candidates::fromValue(v)), from, next);
+            }
+            else
+            {
+                for (Bitboard cells = links_.cells(v) & Bitboard::peers(i); !cells.empty();)
+                {
+                    visit(OFF, cells.pop(), v, from, next);
+                }
+                for (int w = 1; w <= Board::SIZE; ++w)
+                {
+                    if (w != v && Candidates::includes(candidates_[i], w))
+                        visit(OFF, i, w, from, next);
+                }
+            }
+        }
+
+        // Chains of a single strong link are left to the simpler techniques
+        if (strong && length >= 3)
+        {
+            for (int last : next)
+            {
+                if (eliminates(root, last, indexes, values))
+                    return last;
+            }
+        }
+        current.swap(next);
+    }
+    return -1;
+}
+
+void AIC::visit(State state, int i, int v, int from, std::vector<int> & next)
+{
+    Bitboard & visited = visited_[state][v - 1];
+    if (visited.test(i))
+        return;
+
+    visited.set(i);
+    parents_[state][node(i, v)] = from;
+    next.push_back(node(i, v));
+}
+
+bool AIC::eliminates(int node0, int node1, std::vector<int> & indexes, std::vector<int> & values) const
+{
+    int i0 = cellOf(node0);
+    int v0 = valueOf(node0);
+    int i1 = cellOf(node1);
+    int v1 = valueOf(node1);
+
+    // If both are in the same cell, then the cell cannot have any other values
+    if (i0 == i1)
+    {
+        Candidates::Type others = candidates_[i0] & ~Candidates::fromValue(v0) & ~Candidates::fromValue(v1);
+        if (others == Candidates::NONE)
+            return false;
+        indexes = { i0 };
+        values  = Candidates::values(others);
+        return true;
+    }
+
+    // If both have the same value, then no cell that can see both can have the value
+    if (v0 == v1)
+    {
+        Bitboard eliminated = links_.cells(v0) & Bitboard::peers(i0) & Bitboard::peers(i1);
+        if (eliminated.empty())
+            return false;
+        indexes = eliminated.indexes();
+        values  = { v0 };
+        return true;
+    }
+
+    // If the cells can see each other, then whichever is true, neither can have the other's value
+    if (Bitboard::peers(i0).test(i1))
+    {
+        if (Candidates::includes(candidates_[i0], v1))
+        {
+            indexes = { i0 };
+            values  = { v1 };
+            return true;
+        }
+        if (Candidates::includes(candidates_[i1], v0))
+        {
+            indexes = { i1 };
+            values  = { v0 };
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string AIC::generateReason(int root, int last, std::vector<int> const & indexes, std::vector<int> const & values) const
+{
+    // Follow the chain back from the last candidate to the root
+    std::vector<int> chain;
+    int              n     = last;
+    State            state = ON;
+    for (;;)
+    {
+        chain.push_back(n);
+        if (n == root && state == OFF)
+            break;
+        n     = parents_[state][n];
+        state = (state == ON) ? OFF : ON;
+    }
+    std::reverse(chain.begin(), chain.end());
+
+    std::string reason = "If square " + Board::Cell::name(cellOf(root)) + " is not " + std::to_string(valueOf(root)) + ", then ";
+    for (size_t k = 1; k < chain.size(); ++k)
+    {
+        if (k > 1)
+            reason += ", so ";
+        reason += Board::Cell::name(cellOf(chain[k])) + ((k % 2 != 0) ? " is " : " is not ") + std::to_string(valueOf(chain[k]));
+    }
+    if (last == root)
+    {
+        reason += ". So, square " + Board::Cell::name(cellOf(root)) + " must be " + std::to_string(valueOf(root)) + ", and ";
+    }
+    else
+    {
+        reason += ". Either square " + Board::Cell::name(cellOf(root)) + " is " + std::to_string(valueOf(root)) + " or square " +
+                  Board::Cell::name(cellOf(last)) + " is " + std::to_string(valueOf(last)) + ", so ";
+    }
+    for (auto i : indexes)
+    {
+        reason += Board::Cell::name(i);
+        reason += ' ';
+    }
+    reason += "cannot be ";
+    for (size_t k = 0; k < values.size(); ++k)
+    {
+        if (k > 0)
+            reason += " or ";
+        reason += std::to_string(values[k]);
+    }
+    reason += ".";
+    return reason;
+}
@@ -0,0 +1,68 @@
+#if !defined(ANALYZER_AIC_H_INCLUDED)
+#define ANALYZER_AIC_H_INCLUDED 1
+#pragma once
+
+#include "Bitboard.h"
+#include "Board/Board.h"
+#include "Candidates.h"
+#include "LinkGraph.h"
+#include <string>
+#include <vector>
+
+// Finds alternating inference chains (AICs), which include xy-chains.
+//
+// The nodes of a chain are candidates (a cell and a value). Two candidates are strongly linked if at least one of them must be true:
+// the same value in a conjugate pair, or the two values of a bivalue cell. Two candidates are weakly linked if at most one of them
+// can be true: the same value in two cells that see each other, or two values of the same cell. If a chain starts and ends with
+// strong links, then either its first or its last candidate is true, and any candidate that conflicts with both is eliminated.
+//
+// Chains are followed breadth-first from each candidate, up to a bounded number of links. The candidates reached by each kind of link
+// are kept as a set of cells for each value, so each candidate is visited at most once as true and once as false.
+class AIC
+{
+public:
+    AIC(Candidates::List const & candidates, LinkGraph const & links)
+        : candidates_(candidates)
+        , links_(links)
+    {
+    }
+
+    // Returns true if an alternating inference chain exists and candidates can be eliminated because of it
+    // Returns the indexes and values to eliminate and a description
+    bool exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason);
+
+private:
+    static int constexpr MAX_LENGTH = 15;                           // Maximum number of links in a chain
+    static int constexpr NUM_NODES  = Board::NUM_CELLS * Board::SIZE; // Number of candidates
+
+    // Whether a candidate in a chain is assumed to be false or true
+    enum State
+    {
+        OFF,
+        ON
+    };
+
+    static int node(int i, int v) { return i * Board::SIZE + v - 1; }
+    static int cellOf(int node) { return node / Board::SIZE; }
+    static int valueOf(int node) { return node % Board::SIZE + 1; }
+
+    // Follows the chains from the root, assumed to be false. Returns the last candidate of a useful chain, or -1 if none is found.
+    int search(int root, std::vector<int> & indexes, std::vector<int> & values);
+
+    // Returns true if a candidate can be eliminated because one of the two candidates must be true
+    bool eliminates(int node0, int node1, std::vector<int> & indexes, std::vector<int> & values) const;
+
+    // Adds a candidate reached from another by a link, if it has not already been reached in that state
+    void visit(State state, int i, int v, int from, std::vector<int> & next);
+
+    std::string generateReason(int root, int last, std::vector<int> const & indexes, std::vector<int> const & values) const;
+
+    Candidates::List const & candidates_;
+    LinkGraph const & links_;
+
+    // Search context
+    Bitboard visited_[2][Board::SIZE];  // Candidates reached in each state, as the cells with each value
+    int parents_[2][NUM_NODES];         // The candidate each candidate was reached from, in each state
+};
+
+#endif // defined(ANALYZER_AIC_H_INCLUDED)
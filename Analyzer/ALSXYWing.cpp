@@ -0,0 +1,107 @@
+#include "ALSXYWing.h"
+
+#include "AlmostLockedSets.h"
+#include "Bitboard.h"
+#include "Candidates.h"
+
+#include "Board/Board.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+// A set linked to the pivot by a restricted common candidate
+struct Wing
+{
+    int set;    // Index of the set
+    int value;  // The restricted common candidate
+};
+} // anonymous namespace
+
+bool ALSXYWing::exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason) const
+{
+    std::vector<AlmostLockedSets::Set> const & sets = sets_.sets();
+    std::vector<Wing>                          wings;
+    for (size_t p = 0; p < sets.size(); ++p)
+    {
+        AlmostLockedSets::Set const & pivot = sets[p];
+
+        // Find the sets linked to the pivot
+        wings.clear();
+        for (size_t k = 0; k < sets.size(); ++k)
+        {
+            if (k == p || !(sets[k].cells & pivot.cells).empty())
+                continue;
+            for (int v = 1; v <= Board::SIZE; ++v)
+            {
+                if (AlmostLockedSets::isRestrictedCommon(pivot, sets[k], v))
+                    wings.push_back({ (int)k, v });
+            }
+        }
+
+        for (size_t w0 = 0; w0 < wings.size(); ++w0)
+        {
+            AlmostLockedSets::Set const & a = sets[wings[w0].set];
+            int                           x = wings[w0].value;
+            for (size_t w1 = w0 + 1; w1 < wings.size(); ++w1)
+            {
+                AlmostLockedSets::Set const & b = sets[wings[w1].set];
+                int                           y = wings[w1].value;
+                if (x == y || !(a.cells & b.cells).empty())
+                    continue;
+
+                Candidates::Type common = a.values & b.values & ~Candidates::fromValue(x) & ~Candidates::fromValue(y);
+                for (int z = 1; z <= Board::SIZE; ++z)
+                {
+                    if (!Candidates::includes(common, z))
+                        continue;
+
+                    Bitboard eliminated = sets_.seenByBoth(a, b, z);
+                    if (!eliminated.empty())
+                    {
+                        indexes = eliminated.indexes();
+                        values.push_back(z);
+                        reason = generateReason(a, b, pivot, x, y, z, indexes);
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+    return false;
+}
+
+std::string ALSXYWing::generateReason(AlmostLockedSets::Set const & a,
+                                      AlmostLockedSets::Set const & b,
+                                      AlmostLockedSets::Set const & pivot,
+                                      int                           x,
+                                      int                           y,
+                                      int                           z,
+                                      std::vector<int> const &      eliminated)
+{
+    std::string reason;
+    reason = "Squares " +
+             AlmostLockedSets::describe(pivot) +
+             ". Only one of these squares or squares " +
+             AlmostLockedSets::describe(a) +
+             " can have the value " +
+             std::to_string(x) +
+             ", and only one of them or squares " +
+             AlmostLockedSets::describe(b) +
+             " can have the value " +
+             std::to_string(y) +
+             ". They cannot both be missing from the first set, so one of the other sets must have all of its other values, and"
+             " so one of them must have the value " +
+             std::to_string(z) +
+             ". Either way, ";
+    for (auto e : eliminated)
+    {
+        reason += Board::Cell::name(e);
+        reason += ' ';
+    }
+    reason += "cannot be " +
+              std::to_string(z) +
+              ".";
+    return reason;
+}
@@ -0,0 +1,36 @@
+#if !defined(ANALYZER_ALSXYWING_H_INCLUDED)
+#define ANALYZER_ALSXYWING_H_INCLUDED 1
+#pragma once
+
+#include "AlmostLockedSets.h"
+#include <string>
+#include <vector>
+
+// Finds ALS-XY-wings.
+//
+// The pivot is an almost locked set that has a restricted common candidate x with one other set and a different restricted common
+// candidate y with another (none of the three overlap). The pivot cannot be missing both x and y, so at least one of the other two
+// sets is locked. Any value z common to those two sets must then be in one of them, so z can be eliminated from every cell that can
+// see all the cells with z in both.
+class ALSXYWing
+{
+public:
+    ALSXYWing(AlmostLockedSets const & sets) : sets_(sets) {}
+
+    // Returns true if an ALS-XY-wing exists and candidates can be eliminated because of it
+    // Returns the indexes and values to eliminate and a description
+    bool exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason) const;
+
+private:
+    static std::string generateReason(AlmostLockedSets::Set const & a,
+                                      AlmostLockedSets::Set const & b,
+                                      AlmostLockedSets::Set const & pivot,
+                                      int                           x,
+                                      int                           y,
+                                      int                           z,
+                                      std::vector<int> const &      eliminated);
+
+    AlmostLockedSets const & sets_;
+};
+
+#endif // defined(ANALYZER_ALSXYWING_H_INCLUDED)
@@ -0,0 +1,77 @@
+#include "ALSXZ.h"
+
+#include "AlmostLockedSets.h"
+#include "Bitboard.h"
+#include "Candidates.h"
+
+#include "Board/Board.h"
+
+#include <string>
+#include <vector>
+
+bool ALSXZ::exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason) const
+{
+    std::vector<AlmostLockedSets::Set> const & sets = sets_.sets();
+    for (size_t k0 = 0; k0 < sets.size(); ++k0)
+    {
+        AlmostLockedSets::Set const & a = sets[k0];
+        for (size_t k1 = k0 + 1; k1 < sets.size(); ++k1)
+        {
+            AlmostLockedSets::Set const & b = sets[k1];
+
+            // The sets must not overlap and must have at least two values in common
+            Candidates::Type common = a.values & b.values;
+            if (!(a.cells & b.cells).empty() || Candidates::count(common) < 2)
+                continue;
+
+            for (int x = 1; x <= Board::SIZE; ++x)
+            {
+                if (!AlmostLockedSets::isRestrictedCommon(a, b, x))
+                    continue;
+
+                for (int z = 1; z <= Board::SIZE; ++z)
+                {
+                    if (z == x || !Candidates::includes(common, z))
+                        continue;
+
+                    Bitboard eliminated = sets_.seenByBoth(a, b, z);
+                    if (!eliminated.empty())
+                    {
+                        indexes = eliminated.indexes();
+                        values.push_back(z);
+                        reason = generateReason(a, b, x, z, indexes);
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+    return false;
+}
+
+std::string ALSXZ::generateReason(AlmostLockedSets::Set const & a,
+                                  AlmostLockedSets::Set const & b,
+                                  int                           x,
+                                  int                           z,
+                                  std::vector<int> const &      eliminated)
+{
+    std::string reason;
+    reason = "Squares " +
+             AlmostLockedSets::describe(a) +
+             ", and squares " +
+             AlmostLockedSets::describe(b) +
+             ". Only one of these sets can have the value " +
+             std::to_string(x) +
+             ", so the other must have all of its other values, and so one of them must have the value " +
+             std::to_string(z) +
+             ". Either way, ";
+    for (auto e : eliminated)
+    {
+        reason += Board::Cell::name(e);
+        reason += ' ';
+    }
+    reason += "cannot be " +
+              std::to_string(z) +
+              ".";
+    return reason;
+}
@@ -0,0 +1,33 @@
+#if !defined(ANALYZER_ALSXZ_H_INCLUDED)
+#define ANALYZER_ALSXZ_H_INCLUDED 1
+#pragma once
+
+#include "AlmostLockedSets.h"
+#include <string>
+#include <vector>
+
+// Finds ALS-XZ patterns.
+//
+// If two almost locked sets that do not overlap share a restricted common candidate x, then x can be in only one of them, so the
+// other is locked. Any other value z common to both must then be in one of them, so z can be eliminated from every cell that can see
+// all the cells with z in both sets.
+class ALSXZ
+{
+public:
+    ALSXZ(AlmostLockedSets const & sets) : sets_(sets) {}
+
+    // Returns true if an ALS-XZ pattern exists and candidates can be eliminated because of it
+    // Returns the indexes and values to eliminate and a description
+    bool exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason) const;
+
+private:
+    static std::string generateReason(AlmostLockedSets::Set const & a,
+                                      AlmostLockedSets::Set const & b,
+                                      int                           x,
+                                      int                           z,
+                                      std::vector<int> const &      eliminated);
+
+    AlmostLockedSets const & sets_;
+};
+
+#endif // defined(ANALYZER_ALSXZ_H_INCLUDED)
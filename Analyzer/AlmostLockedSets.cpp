@@ -0,0 +1,115 @@
+#include "AlmostLockedSets.h"
+
+#include "Bitboard.h"
+#include "Candidates.h"
+#include "Combinations.h"
+#include "LinkGraph.h"
+#include "Positions.h"
+
+#include "Board/Board.h"
+
+#include <string>
+#include <vector>
+
+AlmostLockedSets::AlmostLockedSets(Candidates::List const & candidates, LinkGraph const & links)
+    : candidates_(candidates)
+    , links_(links)
+{
+    for (int g = 0; g < Positions::NUM_GROUPS; ++g)
+    {
+        // Only unsolved cells can be in a set
+        std::vector<int> const & group = Positions::indexes(g);
+        unsigned                 masks[Board::SIZE];
+        unsigned                 eligible = 0;
+        for (int k = 0; k < Board::SIZE; ++k)
+        {
+            masks[k] = candidates_[group[k]];
+            if (!Candidates::isSolved(masks[k]))
+                eligible |= 1u << k;
+        }
+
+        find<1>(g, masks, eligible);
+        find<2>(g, masks, eligible);
+        find<3>(g, masks, eligible);
+        find<4>(g, masks, eligible);
+    }
+}
+
+template <int N>
+void AlmostLockedSets::find(int g, unsigned const (&masks)[Board::SIZE], unsigned eligible)
+{
+    std::vector<int> const & group = Positions::indexes(g);
+    for (auto const & combination : COMBINATIONS<N>.table)
+    {
+        if ((combination.mask & ~eligible) != 0)
+            continue;
+
+        Candidates::Type values = Candidates::NONE;
+        for (int e : combination.elements)
+        {
+            values |= masks[e];
+        }
+        if (Candidates::count(values) != N + 1)
+            continue;
+
+        Set set;
+        set.group  = g;
+        set.values = values;
+        for (int e : combination.elements)
+        {
+            set.cells.set(group[e]);
+        }
+
+        // A set whose cells are all in an earlier group (a row, or a column for a box) has already been found in that group
+        if (g >= Positions::column(0))
+        {
+            int i = set.cells.first();
+            if ((set.cells & ~Bitboard::group(Positions::row(Board::Group::whichRow(i)))).empty())
+                continue;
+            if (g >= Positions::box(0) && (set.cells & ~Bitboard::group(Positions::column(Board::Group::whichColumn(i)))).empty())
+                continue;
+        }
+
+        for (int e : combination.elements)
+        {
+            for (int v : Candidates::values(masks[e]))
+            {
+                set.with[v - 1].set(group[e]);
+            }
+        }
+        for (int v = 1; v <= Board::SIZE; ++v)
+        {
+            if (!Candidates::includes(values, v))
+                continue;
+
+            set.seen[v - 1] = Bitboard::all();
+            for (Bitboard with = set.with[v - 1]; !with.empty();)
+            {
+                set.seen[v - 1] &= Bitboard::peers(with.pop());
+            }
+        }
+        sets_.push_back(set);
+    }
+}
+
+std::string AlmostLockedSets::describe(Set const & set)
+{
+    std::vector<int> cells  = set.cells.indexes();
+    std::vector<int> values = Candidates::values(set.values);
+
+    std::string description;
+    for (size_t k = 0; k < cells.size(); ++k)
+    {
+        if (k > 0)
+            description += (k + 1 < cells.size()) ? ", " : " and ";
+        description += Board::Cell::name(cells[k]);
+    }
+    description += " in " + Positions::name(set.group) + ", which can only be ";
+    for (size_t k = 0; k < values.size(); ++k)
+    {
+        if (k > 0)
+            description += (k + 1 < values.size()) ? ", " : " or ";
+        description += std::to_string(values[k]);
+    }
+    return description;
+}
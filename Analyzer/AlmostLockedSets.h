@@ -0,0 +1,63 @@
+#if !defined(ANALYZER_ALMOSTLOCKEDSETS_H_INCLUDED)
+#define ANALYZER_ALMOSTLOCKEDSETS_H_INCLUDED 1
+#pragma once
+
+#include "Bitboard.h"
+#include "Board/Board.h"
+#include "Candidates.h"
+#include "LinkGraph.h"
+#include <string>
+#include <vector>
+
+// The almost locked sets in every row, column and box, found once and shared by the ALS techniques.
+//
+// An almost locked set (ALS) is N cells in a group that together have exactly N + 1 candidates. A bivalue cell is an ALS of one cell.
+// The sets are found with the same table of combinations as the subset search, by testing the union of the cells' candidates. For
+// each value, the cells of a set with the value and the cells that can see all of them are kept, so testing whether a value is a
+// restricted common candidate of two sets (each cell with the value in one sees each cell with it in the other) is one AND.
+class AlmostLockedSets
+{
+public:
+    static int constexpr MAX_SIZE = 4;  // Maximum number of cells in a set
+
+    // An almost locked set
+    struct Set
+    {
+        int              group;              // Group (see Positions) containing the cells
+        Candidates::Type values;             // Candidates of the cells
+        Bitboard         cells;              // The cells
+        Bitboard         with[Board::SIZE];  // Cells with each value (- 1)
+        Bitboard         seen[Board::SIZE];  // Cells that can see every cell with each value (- 1)
+    };
+
+    // Constructor
+    AlmostLockedSets(Candidates::List const & candidates, LinkGraph const & links);
+
+    // Returns the sets, by group and then by size
+    std::vector<Set> const & sets() const { return sets_; }
+
+    // Returns true if value v is a restricted common candidate of two sets that do not overlap
+    static bool isRestrictedCommon(Set const & a, Set const & b, int v)
+    {
+        return Candidates::includes(a.values & b.values, v) && (b.with[v - 1] & ~a.seen[v - 1]).empty();
+    }
+
+    // Returns the cells with value v that can see every cell with the value in both sets
+    Bitboard seenByBoth(Set const & a, Set const & b, int v) const
+    {
+        return links_.cells(v) & a.seen[v - 1] & b.seen[v - 1];
+    }
+
+    // Returns a description of a set, such as "A1 and A2 in row A, which can only be 1, 5 or 7"
+    static std::string describe(Set const & set);
+
+private:
+    template <int N>
+    void find(int g, unsigned const (&masks)[Board::SIZE], unsigned eligible);
+
+    Candidates::List const & candidates_;
+    LinkGraph const & links_;
+    std::vector<Set> sets_;
+};
+
+#endif // defined(ANALYZER_ALMOSTLOCKEDSETS_H_INCLUDED)
@@ -1,15 +1,22 @@
 #include "Analyzer.h"
 
+#include "AIC.h"
+#include "ALSXYWing.h"
+#include "ALSXZ.h"
+#include "AlmostLockedSets.h"
+#include "Bifurcation.h"
 #include "Candidates.h"
+#include "Fish.h"
 #include "Hidden.h"
 #include "Link.h"
 #include "LockedCandidates.h"
 #include "Naked.h"
 #include "SimpleColoring.h"
 #include "UniqueRectangle.h"
+#include "WWing.h"
 #include "XCycle.h"
-#include "XWing.h"
 #include "XYWing.h"
+#include "XYZWing.h"
 
 #include "Board/Board.h"
 #if defined(_DEBUG)
@@ -20,6 +27,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <memory>
 #include <numeric>
 
 #if !defined(XCODE_COMPATIBLE_ASSERT)
@@ -39,32 +47,58 @@ struct TechniqueInfoEntry
 };
 
 // Info about techniques by technique ID
-static TechniqueInfoEntry const TECHNIQUE_INFO[Analyzer::Step::NUMBER_OF_TECHNIQUES] =
+static TechniqueInfoEntry constexpr TECHNIQUE_INFO[Analyzer::Step::NUMBER_OF_TECHNIQUES] =
 {
-    { "none",              0 },     // Analyzer::Step::NONE,
-    { "naked single",      1 },     // Analyzer::Step::NAKED_SINGLE,
-    { "naked pair",        2 },     // Analyzer::Step::NAKED_PAIR,
-    { "naked triple",      3 },     // Analyzer::Step::NAKED_TRIPLE,
-    { "naked quad",        5 },     // Analyzer::Step::NAKED_QUAD,
-    { "hidden single",     1 },     // Analyzer::Step::HIDDEN_SINGLE,
-    { "hidden pair",       2 },     // Analyzer::Step::HIDDEN_PAIR,
-    { "hidden triple",     3 },     // Analyzer::Step::HIDDEN_TRIPLE,
-    { "hidden quad",       5 },     // Analyzer::Step::HIDDEN_QUAD,
-    { "locked candidates", 4 },     // Analyzer::Step::LOCKED_CANDIDATES,
-    { "x-wing",            6 },     // Analyzer::Step::X_WING,
-    { "swordfish",         7 },     // Analyzer::Step::SWORDFISH,
-    { "jellyfish",         8 },     // Analyzer::Step::JELLYFISH,
-    { "xy-wing",           7 },     // Analyzer::Step::XY_WING,
-    { "simple coloring",   8 },     // Analyzer::Step::SIMPLE_COLORING,
-    { "unique rectangle",  8 },     // Analyzer::Step::UNIQUE_RECTANGLE,
-    { "x-cycle",           9 }      // Analyzer::Step::X_CYCLE,
+    { "none",                         0 },  // Analyzer::Step::NONE,
+    { "naked single",                 1 },  // Analyzer::Step::NAKED_SINGLE,
+    { "naked pair",                   2 },  // Analyzer::Step::NAKED_PAIR,
+    { "naked triple",                 3 },  // Analyzer::Step::NAKED_TRIPLE,
+    { "naked quad",                   5 },  // Analyzer::Step::NAKED_QUAD,
+    { "hidden single",                1 },  // Analyzer::Step::HIDDEN_SINGLE,
+    { "hidden pair",                  2 },  // Analyzer::Step::HIDDEN_PAIR,
+    { "hidden triple",                3 },  // Analyzer::Step::HIDDEN_TRIPLE,
+    { "hidden quad",                  5 },  // Analyzer::Step::HIDDEN_QUAD,
+    { "locked candidates",            4 },  // Analyzer::Step::LOCKED_CANDIDATES,
+    { "x-wing",                       6 },  // Analyzer::Step::X_WING,
+    { "swordfish",                    7 },  // Analyzer::Step::SWORDFISH,
+    { "jellyfish",                    8 },  // Analyzer::Step::JELLYFISH,
+    { "xy-wing",                      7 },  // Analyzer::Step::XY_WING,
+    { "simple coloring",              8 },  // Analyzer::Step::SIMPLE_COLORING,
+    { "unique rectangle",             8 },  // Analyzer::Step::UNIQUE_RECTANGLE,
+    { "x-cycle",                      9 },  // Analyzer::Step::X_CYCLE,
+    { "finned x-wing",                7 },  // Analyzer::Step::FINNED_X_WING,
+    { "finned swordfish",             8 },  // Analyzer::Step::FINNED_SWORDFISH,
+    { "finned jellyfish",             9 },  // Analyzer::Step::FINNED_JELLYFISH,
+    { "xyz-wing",                     7 },  // Analyzer::Step::XYZ_WING,
+    { "w-wing",                       8 },  // Analyzer::Step::W_WING,
+    { "alternating inference chain", 10 },  // Analyzer::Step::ALTERNATING_INFERENCE_CHAIN,
+    { "als-xz",                      10 },  // Analyzer::Step::ALS_XZ,
+    { "als-xy-wing",                 11 },  // Analyzer::Step::ALS_XY_WING,
+    { "bifurcation",                 12 }   // Analyzer::Step::BIFURCATION,
 };
 static_assert((size_t)Analyzer::Step::NUMBER_OF_TECHNIQUES == sizeof(TECHNIQUE_INFO) / sizeof(*TECHNIQUE_INFO),
               "TECHNIQUE_INFO has the wrong number of elements");
 
+// Returns the highest difficulty in TECHNIQUE_INFO
+static int constexpr highestTechniqueDifficulty()
+{
+    int highest = 0;
+    for (auto const & info : TECHNIQUE_INFO)
+    {
+        if (info.difficulty > highest)
+            highest = info.difficulty;
+    }
+    return highest;
+}
+static_assert(Analyzer::Step::MAX_TECHNIQUE_DIFFICULTY == highestTechniqueDifficulty(),
+              "Analyzer::Step::MAX_TECHNIQUE_DIFFICULTY does not match TECHNIQUE_INFO");
+
+static unsigned constexpr ALL_GROUPS = (1u << Positions::NUM_GROUPS) - 1;   // Mask of every group
+
 Analyzer::Analyzer(Board const & board)
     : board_(board)
     , candidates_(Board::NUM_CELLS, (Candidates::Type)Candidates::ALL)
+    , uncheckedGroups_(ALL_GROUPS)
 #if defined(_DEBUG)
     , solvedBoard_(board)
 #endif // defined(_DEBUG)
@@ -85,7 +119,9 @@ Analyzer::Analyzer(Board const & board)
                                  int x = board.get(i);
 
                                  // The cell has only one candidate
+                                 positions_.update(i, candidates_[i], Candidates::fromValue(x));
                                  candidates_[i] = Candidates::fromValue(x);
+                                 touch(i);
 
                                  // Eliminate this cell's value from its dependents' candidates
                                  std::vector<int> dependents = Board::Cell::dependents(i);
@@ -94,6 +130,14 @@ Analyzer::Analyzer(Board const & board)
                              return true;
                          });
 
+    // Initialize the singles bookkeeping
+    for (int i = 0; i < Board::NUM_CELLS; ++i)
+    {
+        touch(i);
+        if (board_.isEmpty(i))
+            ++unsolved_;
+    }
+
 #if defined(_DEBUG)
     // Sanity check -- validate the candidates
     XCODE_COMPATIBLE_ASSERT(candidatesAreValid());
@@ -103,10 +147,21 @@ Analyzer::Analyzer(Board const & board)
 Analyzer::Analyzer(Board const & board, Candidates::List const & candidates)
     : board_(board)
     , candidates_(candidates)
+    , positions_(candidates)
+    , links_(candidates)
+    , uncheckedGroups_(ALL_GROUPS)
 #if defined(_DEBUG)
     , solvedBoard_(board)
 #endif // defined(_DEBUG)
 {
+    // Initialize the singles bookkeeping
+    for (int i = 0; i < Board::NUM_CELLS; ++i)
+    {
+        touch(i);
+        if (board_.isEmpty(i))
+            ++unsolved_;
+    }
+
 #if defined(_DEBUG)
     XCODE_COMPATIBLE_ASSERT(board_.consistent());
     XCODE_COMPATIBLE_ASSERT(Solver::hasUniqueSolution(board_));
@@ -123,37 +178,40 @@ Analyzer::Step Analyzer::next()
 {
     XCODE_COMPATIBLE_ASSERT(candidatesAreValid());
 
-    if (board_.completed())
+    if (unsolved_ == 0)
     {
         solved_ = true;
         return { Step::DONE, Step::NONE, {}, {}, "Solved." };
     }
 
     // Ensure that every cell has at least one candidate. If not, then the board is not solvable.
-    for (int i = 0; i < Board::NUM_CELLS; ++i)
+    if (!noCandidates_.empty())
     {
-        if (candidates_[i] == Candidates::NONE)
-        {
-            std::vector<int> indexes{ i };
-            std::vector<int> values{ 0 };
-            std::string      reason = "The puzzle cannot be solved. There is no possible value for " + Board::Cell::name(i) + ".";
-            stuck_ = true;
-            return { Step::STUCK, Step::NONE, {}, {}, reason };
-        }
+        int         i      = noCandidates_.first();
+        std::string reason = "The puzzle cannot be solved. There is no possible value for " + Board::Cell::name(i) + ".";
+        stuck_ = true;
+        return { Step::STUCK, Step::NONE, {}, {}, reason };
     }
 
     // Technique ids sorted by difficulty
     XCODE_COMPATIBLE_ASSERT(Step::NONE == 0);
-    std::vector<int> sortedIds(Step::NUMBER_OF_TECHNIQUES - 1); // Skip NONE
-    std::iota(sortedIds.begin(), sortedIds.end(), Step::NONE + 1);
-    std::sort(sortedIds.begin(), sortedIds.end(), [] (int a, int b) {
-                  return TECHNIQUE_INFO[a].difficulty < TECHNIQUE_INFO[b].difficulty;
-              });
+    static std::vector<int> const sortedIds = [] () {
+                                                  std::vector<int> ids(Step::NUMBER_OF_TECHNIQUES - 1); // Skip NONE
+                                                  std::iota(ids.begin(), ids.end(), Step::NONE + 1);
+                                                  std::stable_sort(ids.begin(), ids.end(), [] (int a, int b) {
+                                                                       return TECHNIQUE_INFO[a].difficulty <
+                                                                              TECHNIQUE_INFO[b].difficulty;
+                                                                   });
+                                                  return ids;
+                                              } ();
 
     std::vector<int> indexes;
     std::vector<int> values;
     std::string      reason;
 
+    // The almost locked sets are found only if an ALS technique is reached, and then only once for all of them
+    std::unique_ptr<AlmostLockedSets> almostLockedSets;
+
     // Try each technique in order of difficulty
     for (auto id : sortedIds)
     {
@@ -164,8 +222,7 @@ Analyzer::Step Analyzer::next()
         {
             case Step::NAKED_SINGLE:
             {
-                Naked naked(board_, candidates_);
-                found  = naked.singleExists(indexes, values, reason);
+                found  = nakedSingleExists(indexes, values, reason);
                 action = Step::SOLVE;
                 break;
             }
@@ -192,63 +249,62 @@ Analyzer::Step Analyzer::next()
             }
             case Step::HIDDEN_SINGLE:
             {
-                Hidden hidden(board_, candidates_);
-                found  = hidden.singleExists(indexes, values, reason);
+                found  = hiddenSingleExists(indexes, values, reason);
                 action = Step::SOLVE;
                 break;
             }
             case Step::HIDDEN_PAIR:
             {
-                Hidden hidden(board_, candidates_);
+                Hidden hidden(board_, candidates_, positions_);
                 found  = hidden.pairExists(indexes, values, reason);
                 action = Step::ELIMINATE;
                 break;
             }
             case Step::HIDDEN_TRIPLE:
             {
-                Hidden hidden(board_, candidates_);
+                Hidden hidden(board_, candidates_, positions_);
                 found  = hidden.tripleExists(indexes, values, reason);
                 action = Step::ELIMINATE;
                 break;
             }
             case Step::HIDDEN_QUAD:
             {
-                Hidden hidden(board_, candidates_);
+                Hidden hidden(board_, candidates_, positions_);
                 found  = hidden.quadExists(indexes, values, reason);
                 action = Step::ELIMINATE;
                 break;
             }
             case Step::LOCKED_CANDIDATES:
             {
-                LockedCandidates lockedCandidates(candidates_);
+                LockedCandidates lockedCandidates(links_);
                 found  = lockedCandidates.exists(indexes, values, reason);
                 action = Step::ELIMINATE;
                 break;
             }
             case Step::X_WING:
             {
-                XWing xWing(candidates_);
+                XWing xWing(links_);
                 found  = xWing.exists(indexes, values, reason);
                 action = Step::ELIMINATE;
                 break;
             }
             case Step::SWORDFISH:
             {
-                Swordfish swordfish(candidates_);
+                Swordfish swordfish(links_);
                 found  = swordfish.exists(indexes, values, reason);
                 action = Step::ELIMINATE;
                 break;
             }
             case Step::JELLYFISH:
             {
-                Jellyfish jellyfish(candidates_);
+                Jellyfish jellyfish(links_);
                 found  = jellyfish.exists(indexes, values, reason);
                 action = Step::ELIMINATE;
                 break;
             }
             case Step::XY_WING:
             {
-                XYWing xyWing(candidates_);
+                XYWing xyWing(candidates_, links_);
                 found  = xyWing.exists(indexes, values, reason);
                 action = Step::ELIMINATE;
                 break;
@@ -257,26 +313,93 @@ Analyzer::Step Analyzer::next()
             {
                 // Note that one simple coloring heuristic determines both solved cells and eliminated candidates, but to simplify
                 // the code (for now perhaps) we will only eliminate candidates.
-                SimpleColoring simpleColoring(candidates_);
+                SimpleColoring simpleColoring(links_);
                 found  = simpleColoring.exists(indexes, values, reason);
                 action = Step::ELIMINATE;
                 break;
             }
             case Step::UNIQUE_RECTANGLE:
             {
-                UniqueRectangle uniqueRectangle(candidates_);
+                UniqueRectangle uniqueRectangle(candidates_, links_);
                 found  = uniqueRectangle.exists(indexes, values, reason);
                 action = Step::ELIMINATE;
                 break;
             }
             case Step::X_CYCLE:
             {
-                XCycle xcycle(candidates_);
+                XCycle xcycle(candidates_, links_);
                 bool   solves = false;
                 found  = xcycle.exists(indexes, values, reason, solves);
                 action = solves ? Step::SOLVE : Step::ELIMINATE;
                 break;
             }
+            case Step::FINNED_X_WING:
+            {
+                XWing xWing(links_);
+                found  = xWing.finnedExists(indexes, values, reason);
+                action = Step::ELIMINATE;
+                break;
+            }
+            case Step::FINNED_SWORDFISH:
+            {
+                Swordfish swordfish(links_);
+                found  = swordfish.finnedExists(indexes, values, reason);
+                action = Step::ELIMINATE;
+                break;
+            }
+            case Step::FINNED_JELLYFISH:
+            {
+                Jellyfish jellyfish(links_);
+                found  = jellyfish.finnedExists(indexes, values, reason);
+                action = Step::ELIMINATE;
+                break;
+            }
+            case Step::XYZ_WING:
+            {
+                XYZWing xyzWing(candidates_, links_);
+                found  = xyzWing.exists(indexes, values, reason);
+                action = Step::ELIMINATE;
+                break;
+            }
+            case Step::W_WING:
+            {
+                WWing wWing(links_);
+                found  = wWing.exists(indexes, values, reason);
+                action = Step::ELIMINATE;
+                break;
+            }
+            case Step::ALTERNATING_INFERENCE_CHAIN:
+            {
+                AIC aic(candidates_, links_);
+                found  = aic.exists(indexes, values, reason);
+                action = Step::ELIMINATE;
+                break;
+            }
+            case Step::ALS_XZ:
+            {
+                if (!almostLockedSets)
+                    almostLockedSets = std::make_unique<AlmostLockedSets>(candidates_, links_);
+                ALSXZ alsXz(*almostLockedSets);
+                found  = alsXz.exists(indexes, values, reason);
+                action = Step::ELIMINATE;
+                break;
+            }
+            case Step::ALS_XY_WING:
+            {
+                if (!almostLockedSets)
+                    almostLockedSets = std::make_unique<AlmostLockedSets>(candidates_, links_);
+                ALSXYWing alsXyWing(*almostLockedSets);
+                found  = alsXyWing.exists(indexes, values, reason);
+                action = Step::ELIMINATE;
+                break;
+            }
+            case Step::BIFURCATION:
+            {
+                Bifurcation bifurcation(candidates_);
+                found  = bifurcation.exists(indexes, values, reason);
+                action = Step::ELIMINATE;
+                break;
+            }
             default:
                 XCODE_COMPATIBLE_ASSERT(!"Unimplemented technique ID.");
                 break;
@@ -419,10 +542,14 @@ nlohmann::json Analyzer::toJson() const
 void Analyzer::setValue(int i, int x)
 {
     // Update the board
+    if (board_.isEmpty(i))
+        --unsolved_;
     board_.set(i, x);
 
     // The cell has only one candidate now
+    positions_.update(i, candidates_[i], Candidates::fromValue(x));
     candidates_[i] = Candidates::fromValue(x);
+    touch(i);
 
     // Eliminate this cell's value from its dependents' candidates
     std::vector<int> dependents = Board::Cell::dependents(i);
@@ -431,9 +558,15 @@ void Analyzer::setValue(int i, int x)
 
 void Analyzer::eliminate(std::vector<int> const & indexes, int x)
 {
+    Candidates::Type mask = Candidates::fromValue(x);
     for (auto i : indexes)
     {
-        candidates_[i] &= ~Candidates::fromValue(x);
+        if (candidates_[i] & mask)
+        {
+            candidates_[i] &= ~mask;
+            positions_.eliminate(i, x);
+            touch(i);
+        }
         XCODE_COMPATIBLE_ASSERT(candidates_[i] != 0);
     }
 }
@@ -446,9 +579,106 @@ void Analyzer::eliminate(std::vector<int> const & indexes, std::vector<int> cons
     }
 }
 
+// Updates the singles bookkeeping and the link graph after the value or candidates of a cell have changed
+void Analyzer::touch(int i)
+{
+    Candidates::Type c = candidates_[i];
+    links_.update(i, c);
+
+    if (c == Candidates::NONE)
+        noCandidates_.set(i);
+    else
+        noCandidates_.reset(i);
+
+    if (c != Candidates::NONE && Candidates::isSolved(c) && board_.isEmpty(i))
+        nakedSingles_.set(i);
+    else
+        nakedSingles_.reset(i);
+
+    // The cell's groups must be checked for hidden singles again
+    uncheckedGroups_ |= (1u << Positions::row(Board::Group::whichRow(i))) |
+                        (1u << Positions::column(Board::Group::whichColumn(i))) |
+                        (1u << Positions::box(Board::Group::whichBox(i)));
+}
+
+// Returns the same naked single as Naked::singleExists, but without scanning the board
+bool Analyzer::nakedSingleExists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason)
+{
+    if (nakedSingles_.empty())
+        return false;
+
+    Naked naked(board_, candidates_);
+    return naked.singleExists(nakedSingles_.first(), indexes, values, reason);
+}
+
+// Returns the same hidden single as Hidden::singleExists, but only checks the groups that have changed since they were last checked
+bool Analyzer::hiddenSingleExists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason)
+{
+    if (uncheckedGroups_ == 0)
+        return false;
+
+    Hidden hidden(board_, candidates_, positions_);
+    for (int g = 0; g < Positions::NUM_GROUPS; ++g)
+    {
+        if (uncheckedGroups_ & (1u << g))
+        {
+            if (hidden.singleExists(g, indexes, values, reason))
+                return true;
+            uncheckedGroups_ &= ~(1u << g);
+        }
+    }
+    return false;
+}
+
 #if defined(_DEBUG)
 bool Analyzer::candidatesAreValid()
 {
+    // The singles bookkeeping must match the board and the candidates
+    int unsolved = 0;
+    for (int i = 0; i < Board::NUM_CELLS; ++i)
+    {
+        Candidates::Type c = candidates_[i];
+        if (board_.isEmpty(i))
+            ++unsolved;
+        if (noCandidates_.test(i) != (c == Candidates::NONE))
+            return false;
+        if (nakedSingles_.test(i) != (board_.isEmpty(i) && c != Candidates::NONE && Candidates::isSolved(c)))
+            return false;
+    }
+    if (unsolved != unsolved_)
+        return false;
+
+    // The positions must be the transpose of the candidates
+    Positions expected(candidates_);
+    for (int g = 0; g < Positions::NUM_GROUPS; ++g)
+    {
+        for (int v = 1; v <= Board::SIZE; ++v)
+        {
+            if (positions_.get(g, v) != expected.get(g, v))
+                return false;
+        }
+    }
+
+    // The link graph must match the candidates
+    LinkGraph expectedLinks(candidates_);
+    if (links_.bivalues() != expectedLinks.bivalues())
+        return false;
+    for (int v = 1; v <= Board::SIZE; ++v)
+    {
+        if (links_.cells(v) != expectedLinks.cells(v) || links_.conjugates(v) != expectedLinks.conjugates(v))
+            return false;
+        for (int v1 = 1; v1 <= Board::SIZE; ++v1)
+        {
+            if (links_.bivalues(v, v1) != expectedLinks.bivalues(v, v1))
+                return false;
+        }
+        for (int i = 0; i < Board::NUM_CELLS; ++i)
+        {
+            if (links_.strong(i, v) != expectedLinks.strong(i, v))
+                return false;
+        }
+    }
+
     return Board::ForEach::cell([&] (int i) {
                                     int v = solvedBoard_.get(i);
                                     XCODE_COMPATIBLE_ASSERT(v != Board::EMPTY); // Sanity check
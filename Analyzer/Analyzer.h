@@ -2,8 +2,11 @@
 #define ANALYZER_ANALYZER_H_INCLUDED 1
 #pragma once
 
+#include "Bitboard.h"
 #include "Board/Board.h"
 #include "Candidates.h"
+#include "LinkGraph.h"
+#include "Positions.h"
 #include <nlohmann/json.hpp>
 #include <string>
 #include <vector>
@@ -45,9 +48,19 @@ public:
             SIMPLE_COLORING,
             UNIQUE_RECTANGLE,
             X_CYCLE,
-            LAST = X_CYCLE
+            FINNED_X_WING,
+            FINNED_SWORDFISH,
+            FINNED_JELLYFISH,
+            XYZ_WING,
+            W_WING,
+            ALTERNATING_INFERENCE_CHAIN,
+            ALS_XZ,
+            ALS_XY_WING,
+            BIFURCATION,
+            LAST = BIFURCATION
         };
         static int constexpr NUMBER_OF_TECHNIQUES = TechniqueId::LAST - TechniqueId::NONE + 1;
+        static int constexpr MAX_TECHNIQUE_DIFFICULTY = 12;  // Highest difficulty factor of any technique
 
         ActionId action;            // Action perforned in the step
         TechniqueId technique;      // Technique used
@@ -77,6 +90,9 @@ public:
     // Returns the current state of the board
     Board const & board() const { return board_; }
 
+    // Returns the current candidates
+    Candidates::List const & candidates() const { return candidates_; }
+
     // Returns true if the analyzer can make no more progress for whatever reason
     bool done() const { return stuck_ || solved_; }
 
@@ -96,6 +112,9 @@ private:
     void setValue(int i, int x);
     void eliminate(std::vector<int> const & indexes, int x);
     void eliminate(std::vector<int> const & indexes, std::vector<int> const & values);
+    void touch(int i);
+    bool nakedSingleExists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason);
+    bool hiddenSingleExists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason);
 
 #if defined(_DEBUG)
     // Returns true if the candidates data is consistent with the solution
@@ -104,6 +123,12 @@ private:
 
     Board board_;                   // Current state of the board
     Candidates::List candidates_;   // Masks of possible values for each cell
+    Positions positions_;           // Masks of possible cells for each value in each group
+    LinkGraph links_;               // Strong and weak links between cells for each value
+    int unsolved_ = 0;              // Number of empty cells
+    Bitboard noCandidates_;         // Cells with no candidates
+    Bitboard nakedSingles_;         // Empty cells with only one candidate
+    unsigned uncheckedGroups_;      // Groups (see Positions) that have changed since they were last found to have no hidden single
     bool stuck_  = false;           // True if the analyzer  is stumped
     bool solved_ = false;           // True if the board is solved
 #if defined(_DEBUG)
@@ -0,0 +1,180 @@
+#include "Bifurcation.h"
+
+#include "Bitboard.h"
+#include "Candidates.h"
+#include "Positions.h"
+
+#include "Board/Board.h"
+
+#include <algorithm>
+#include <string>
+#include <tuple>
+#include <vector>
+
+bool Bifurcation::exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason)
+{
+    nodes_ = 0;
+    for (int i : order(candidates_))
+    {
+        for (int v : Candidates::values(candidates_[i]))
+        {
+            Candidates::List copy = candidates_;
+            std::string      contradiction;
+            Outcome          outcome = assume(copy, i, v, 1, contradiction);
+            if (outcome == ABANDONED)
+                return false;
+            if (outcome == CONTRADICTION)
+            {
+                indexes.push_back(i);
+                values.push_back(v);
+                reason = "If " + Board::Cell::name(i) + " were " + std::to_string(v) + ", then " + contradiction + ". So " +
+                         Board::Cell::name(i) + " cannot be " + std::to_string(v) + ".";
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Sets cell i to v and fills in the singles that follow. If there is no contradiction and the depth allows it, tries every value of
+// each cell returned by order() in turn.
+Bifurcation::Outcome Bifurcation::assume(Candidates::List & candidates, int i, int v, int depth, std::string & contradiction)
+{
+    candidates[i] = Candidates::fromValue(v);
+    std::vector<int> pending{ i };
+    Outcome          outcome = propagate(candidates, pending, contradiction);
+    if (outcome != OPEN || depth >= MAX_DEPTH)
+        return outcome;
+
+    // If every value of a cell leads to a contradiction, then so does this assumption
+    for (int j : order(candidates))
+    {
+        std::vector<int>         values = Candidates::values(candidates[j]);
+        std::vector<std::string> reasons(values.size());
+        bool                     all = true;
+        for (size_t k = 0; k < values.size() && all; ++k)
+        {
+            Candidates::List copy = candidates;
+            outcome = assume(copy, j, values[k], depth + 1, reasons[k]);
+            if (outcome == ABANDONED)
+                return ABANDONED;
+            all = (outcome == CONTRADICTION);
+        }
+        if (all)
+        {
+            if (values.size() == 2)
+            {
+                contradiction = Board::Cell::name(j) + " could be neither " + std::to_string(values[0]) + " (since then " +
+                                reasons[0] + ") nor " + std::to_string(values[1]) + " (since then " + reasons[1] + ")";
+            }
+            else
+            {
+                contradiction = Board::Cell::name(j) + " could not be";
+                for (size_t k = 0; k < values.size(); ++k)
+                {
+                    contradiction += (k == 0) ? " " : (k + 1 < values.size()) ? ", " : " or ";
+                    contradiction += std::to_string(values[k]) + " (since then " + reasons[k] + ")";
+                }
+            }
+            return CONTRADICTION;
+        }
+    }
+    return OPEN;
+}
+
+// Fills in the naked and hidden singles, starting with the pending cells, until there are no more or there is a contradiction
+Bifurcation::Outcome Bifurcation::propagate(Candidates::List & candidates, std::vector<int> & pending, std::string & contradiction)
+{
+    for (;;)
+    {
+        // Remove the value of each new single from its peers
+        while (!pending.empty())
+        {
+            int i = pending.back();
+            pending.pop_back();
+            if (++nodes_ > budget_)
+                return ABANDONED;
+
+            Candidates::Type mask = candidates[i];
+            for (Bitboard peers = Bitboard::peers(i); !peers.empty();)
+            {
+                int p = peers.pop();
+                if (candidates[p] & mask)
+                {
+                    candidates[p] &= ~mask;
+                    if (candidates[p] == Candidates::NONE)
+                    {
+                        contradiction = Board::Cell::name(p) + " could not be anything";
+                        return CONTRADICTION;
+                    }
+                    if (Candidates::isSolved(candidates[p]))
+                        pending.push_back(p);
+                }
+            }
+        }
+
+        // Find the values in only one cell of a group, and the values in none
+        for (int g = 0; g < Positions::NUM_GROUPS; ++g)
+        {
+            std::vector<int> const & group = Positions::indexes(g);
+            Candidates::Type         once  = Candidates::NONE;
+            Candidates::Type         twice = Candidates::NONE;
+            for (int i : group)
+            {
+                twice |= once & candidates[i];
+                once  |= candidates[i];
+            }
+            if (once != Candidates::ALL)
+            {
+                int missing = Candidates::values(Candidates::ALL & ~once).front();
+                contradiction = std::to_string(missing) + " could not be anywhere in " + Positions::name(g);
+                return CONTRADICTION;
+            }
+
+            Candidates::Type hidden = once & ~twice;
+            for (int i : group)
+            {
+                if ((candidates[i] & hidden) == Candidates::NONE || Candidates::isSolved(candidates[i]))
+                    continue;
+                candidates[i] &= hidden;
+                if (!Candidates::isSolved(candidates[i]))
+                {
+                    std::vector<int> both = Candidates::values(candidates[i]);
+                    contradiction = Board::Cell::name(i) + " would have to be both " + std::to_string(both[0]) + " and " +
+                                    std::to_string(both[1]);
+                    return CONTRADICTION;
+                }
+                pending.push_back(i);
+            }
+        }
+        if (pending.empty())
+            return OPEN;
+    }
+}
+
+// Returns the unsolved cells, those with the fewest candidates first, and then those with the most unsolved peers first
+std::vector<int> Bifurcation::order(Candidates::List const & candidates)
+{
+    Bitboard unsolved;
+    for (int i = 0; i < Board::NUM_CELLS; ++i)
+    {
+        if (!Candidates::isSolved(candidates[i]))
+            unsolved.set(i);
+    }
+
+    std::vector<std::tuple<int, int, int>> cells;   // Number of candidates, number of unsolved peers and index of each cell
+    for (int i = 0; i < Board::NUM_CELLS; ++i)
+    {
+        if (unsolved.test(i))
+            cells.emplace_back(Candidates::count(candidates[i]), -(Bitboard::peers(i) & unsolved).count(), i);
+    }
+    std::sort(cells.begin(), cells.end());
+
+    std::vector<int> indexes;
+    indexes.reserve(cells.size());
+    for (auto const & cell : cells)
+    {
+        indexes.push_back(std::get<2>(cell));
+    }
+    return indexes;
+}
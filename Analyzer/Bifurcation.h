@@ -0,0 +1,55 @@
+#if !defined(ANALYZER_BIFURCATION_H_INCLUDED)
+#define ANALYZER_BIFURCATION_H_INCLUDED 1
+#pragma once
+
+#include "Candidates.h"
+#include <string>
+#include <vector>
+
+// Finds a candidate that leads to a contradiction, by trial and error. This is the last resort.
+//
+// Each value of a cell is assumed in turn, in a copy of the candidates, and the naked and hidden singles that follow are filled in.
+// If that leaves a cell with no candidates, or a value with no place in a row, column or box, then the value is eliminated. If not,
+// the assumption may be extended by trying every value of each cell in the copy, up to a limited depth. The bivalue cells are tried
+// first, and those with the most unsolved peers first among them, since they constrain the most cells. If none of them leads
+// anywhere, or there are none, then the unsolved cells with the fewest candidates are tried next, and so on. The number of cells set
+// in all the copies together is limited, so that the search cannot stall the analysis of a puzzle.
+class Bifurcation
+{
+public:
+    static int constexpr MAX_DEPTH   = 2;       // Maximum number of assumptions in effect at once
+    static int constexpr NODE_BUDGET = 100000;  // Default maximum number of cells set in all the copies together
+
+    // Constructor
+    explicit Bifurcation(Candidates::List const & candidates, int budget = NODE_BUDGET)
+        : candidates_(candidates)
+        , budget_(budget)
+    {
+    }
+
+    // Returns true if a candidate leads to a contradiction and can be eliminated
+    // Returns the index and value to eliminate and a description
+    bool exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason);
+
+    // Returns the number of cells set by the last search
+    int nodes() const { return nodes_; }
+
+private:
+    // Result of an assumption
+    enum Outcome
+    {
+        CONTRADICTION,  // The assumption leads to a contradiction
+        OPEN,           // The assumption does not lead to a contradiction within the depth limit
+        ABANDONED       // The node budget was exhausted
+    };
+
+    Outcome assume(Candidates::List & candidates, int i, int v, int depth, std::string & contradiction);
+    Outcome propagate(Candidates::List & candidates, std::vector<int> & pending, std::string & contradiction);
+    static std::vector<int> order(Candidates::List const & candidates);
+
+    Candidates::List const & candidates_;
+    int budget_;
+    int nodes_ = 0;
+};
+
+#endif // defined(ANALYZER_BIFURCATION_H_INCLUDED)
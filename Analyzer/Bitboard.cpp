@@ -0,0 +1,50 @@
+#include "Bitboard.h"
+
+#include "Positions.h"
+
+#include "Board/Board.h"
+
+namespace
+{
+struct Tables
+{
+    Tables()
+    {
+        for (int g = 0; g < Positions::NUM_GROUPS; ++g)
+        {
+            for (int i : Positions::indexes(g))
+            {
+                groups[g].set(i);
+            }
+        }
+        for (int i = 0; i < Board::NUM_CELLS; ++i)
+        {
+            for (int j : Board::Cell::dependents(i))
+            {
+                peers[i].set(j);
+            }
+        }
+    }
+
+    Bitboard groups[Positions::NUM_GROUPS];
+    Bitboard peers[Board::NUM_CELLS];
+};
+
+Tables const & tables()
+{
+    static Tables const TABLES;
+    return TABLES;
+}
+} // anonymous namespace
+
+Bitboard const & Bitboard::group(int g)
+{
+    XCODE_COMPATIBLE_ASSERT(g >= 0 && g < Positions::NUM_GROUPS);
+    return tables().groups[g];
+}
+
+Bitboard const & Bitboard::peers(int i)
+{
+    XCODE_COMPATIBLE_ASSERT(i >= 0 && i < Board::NUM_CELLS);
+    return tables().peers[i];
+}
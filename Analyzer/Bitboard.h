@@ -0,0 +1,139 @@
+#if !defined(ANALYZER_BITBOARD_H_INCLUDED)
+#define ANALYZER_BITBOARD_H_INCLUDED 1
+#pragma once
+
+#include "Board/Board.h"
+
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif // defined(_MSC_VER)
+
+// A set of cells, as a bit for each cell. Cells 0 - 63 are in the low word and cells 64 - 80 are in the high word.
+class Bitboard
+{
+public:
+    // Constructs an empty set
+    constexpr Bitboard() = default;
+
+    // Constructs a set from its low and high words
+    constexpr Bitboard(uint64_t low, uint64_t high)
+        : low_(low)
+        , high_(high & HIGH_MASK)
+    {
+    }
+
+    // Returns a set containing only the given cell
+    static constexpr Bitboard cell(int i)
+    {
+        return (i < 64) ? Bitboard(uint64_t(1) << i, 0) : Bitboard(0, uint64_t(1) << (i - 64));
+    }
+
+    // Returns a set containing every cell
+    static constexpr Bitboard all() { return Bitboard(~uint64_t(0), HIGH_MASK); }
+
+    // Returns the cells in group g (rows, then columns, then boxes, as numbered by Positions)
+    static Bitboard const & group(int g);
+
+    // Returns the cells that share a row, column or box with cell i, not including cell i
+    static Bitboard const & peers(int i);
+
+    // Returns true if the cell is in the set
+    constexpr bool test(int i) const
+    {
+        return (i < 64) ? ((low_ >> i) & 1) != 0 : ((high_ >> (i - 64)) & 1) != 0;
+    }
+
+    // Adds a cell to the set
+    void set(int i)
+    {
+        if (i < 64)
+            low_ |= uint64_t(1) << i;
+        else
+            high_ |= uint64_t(1) << (i - 64);
+    }
+
+    // Removes a cell from the set
+    void reset(int i)
+    {
+        if (i < 64)
+            low_ &= ~(uint64_t(1) << i);
+        else
+            high_ &= ~(uint64_t(1) << (i - 64));
+    }
+
+    // Returns true if the set is empty
+    constexpr bool empty() const { return (low_ | high_) == 0; }
+
+    // Returns the number of cells in the set
+    int count() const { return countBits(low_) + countBits(high_); }
+
+    // Returns the lowest cell in the set, or -1 if the set is empty
+    int first() const
+    {
+        if (low_ != 0)
+            return lowestBit(low_);
+        if (high_ != 0)
+            return 64 + lowestBit(high_);
+        return -1;
+    }
+
+    // Removes the lowest cell from the set and returns it. The set must not be empty.
+    int pop()
+    {
+        int i = first();
+        reset(i);
+        return i;
+    }
+
+    // Returns the cells in the set in increasing order
+    std::vector<int> indexes() const
+    {
+        std::vector<int> indexes;
+        for (Bitboard b = *this; !b.empty();)
+        {
+            indexes.push_back(b.pop());
+        }
+        return indexes;
+    }
+
+    constexpr Bitboard operator &(Bitboard const & rhs) const { return Bitboard(low_ & rhs.low_, high_ & rhs.high_); }
+    constexpr Bitboard operator |(Bitboard const & rhs) const { return Bitboard(low_ | rhs.low_, high_ | rhs.high_); }
+    constexpr Bitboard operator ^(Bitboard const & rhs) const { return Bitboard(low_ ^ rhs.low_, high_ ^ rhs.high_); }
+    constexpr Bitboard operator ~() const { return Bitboard(~low_, ~high_); }
+    Bitboard & operator &=(Bitboard const & rhs) { return *this = *this & rhs; }
+    Bitboard & operator |=(Bitboard const & rhs) { return *this = *this | rhs; }
+    Bitboard & operator ^=(Bitboard const & rhs) { return *this = *this ^ rhs; }
+    constexpr bool operator ==(Bitboard const & rhs) const { return low_ == rhs.low_ && high_ == rhs.high_; }
+    constexpr bool operator !=(Bitboard const & rhs) const { return !(*this == rhs); }
+
+private:
+    static uint64_t constexpr HIGH_MASK = (uint64_t(1) << (Board::NUM_CELLS - 64)) - 1;
+
+    static int countBits(uint64_t x)
+    {
+#if defined(_MSC_VER)
+        return (int)__popcnt64(x);
+#else
+        return __builtin_popcountll(x);
+#endif // defined(_MSC_VER)
+    }
+
+    static int lowestBit(uint64_t x)
+    {
+#if defined(_MSC_VER)
+        unsigned long i;
+        _BitScanForward64(&i, x);
+        return (int)i;
+#else
+        return __builtin_ctzll(x);
+#endif // defined(_MSC_VER)
+    }
+
+    uint64_t low_  = 0;
+    uint64_t high_ = 0;
+};
+
+#endif // defined(ANALYZER_BITBOARD_H_INCLUDED)
@@ -0,0 +1,68 @@
+#if !defined(ANALYZER_COMBINATIONS_H_INCLUDED)
+#define ANALYZER_COMBINATIONS_H_INCLUDED 1
+#pragma once
+
+#include "Board/Board.h"
+
+// Returns the number of combinations of k of n elements
+constexpr int choose(int n, int k)
+{
+    int c = 1;
+    for (int i = 1; i <= k; ++i)
+    {
+        c = c * (n - k + i) / i;
+    }
+    return c;
+}
+
+// The combinations of N of the 9 elements of a group (or of the 9 rows or columns), in lexicographic order (the order of the
+// equivalent nested loops)
+template <int N>
+struct Combinations
+{
+    static int constexpr COUNT = choose(Board::SIZE, N);
+
+    struct Entry
+    {
+        unsigned mask        = 0;    // The elements as a mask of (1 << element)
+        int      elements[N] = {};   // The elements in increasing order
+    };
+
+    constexpr Combinations()
+        : table()
+    {
+        int e[N] = {};
+        for (int k = 0; k < N; ++k)
+        {
+            e[k] = k;
+        }
+
+        for (int c = 0; c < COUNT; ++c)
+        {
+            for (int k = 0; k < N; ++k)
+            {
+                table[c].elements[k] = e[k];
+                table[c].mask       |= 1u << e[k];
+            }
+
+            // Advance the rightmost element that can be advanced and restart the elements after it
+            int k = N - 1;
+            while (k > 0 && e[k] == Board::SIZE - N + k)
+            {
+                --k;
+            }
+            ++e[k];
+            for (int j = k + 1; j < N; ++j)
+            {
+                e[j] = e[j - 1] + 1;
+            }
+        }
+    }
+
+    Entry table[COUNT];
+};
+
+template <int N>
+inline constexpr Combinations<N> COMBINATIONS{};
+
+#endif // defined(ANALYZER_COMBINATIONS_H_INCLUDED)
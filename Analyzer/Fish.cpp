@@ -0,0 +1,279 @@
+#include "Fish.h"
+
+#include "Bitboard.h"
+#include "Combinations.h"
+#include "LinkGraph.h"
+#include "Positions.h"
+
+#include "Board/Board.h"
+
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif // defined(_MSC_VER)
+
+namespace
+{
+// Returns the number of bits set
+int countBits(unsigned bits)
+{
+#if defined(_MSC_VER)
+    return (int)__popcnt(bits);
+#else
+    return __builtin_popcount(bits);
+#endif // defined(_MSC_VER)
+}
+
+// Returns the items as a list, such as "A", "A and B", or "A, B, and C"
+std::string list(std::vector<std::string> const & items)
+{
+    std::string result = items.front();
+    for (size_t k = 1; k < items.size(); ++k)
+    {
+        if (items.size() > 2)
+            result += ",";
+        result += (k + 1 < items.size()) ? " " : " and ";
+        result += items[k];
+    }
+    return result;
+}
+
+unsigned constexpr STACK = 0x7;   // Mask of the first 3 positions in a line, which are in the same box
+
+char const * const NUMBERS[] = { "zero", "one", "two", "three", "four" };
+} // anonymous namespace
+
+template <int N>
+Fish<N>::Fish(LinkGraph const & links)
+    : masks_()
+{
+    for (int v = 1; v <= Board::SIZE; ++v)
+    {
+        for (Bitboard cells = links.cells(v); !cells.empty();)
+        {
+            int i = cells.pop();
+            int r = Board::Group::whichRow(i);
+            int c = Board::Group::whichColumn(i);
+            masks_[ROWS][v - 1][r]    |= 1u << c;
+            masks_[COLUMNS][v - 1][c] |= 1u << r;
+        }
+    }
+}
+
+template <int N>
+bool Fish<N>::exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason) const
+{
+    // For each value in rows and then in columns, if the value is in 2 to N cells of N lines, and those cells are in only N crossing
+    // lines, then the value cannot be in those N crossing lines in any other lines.
+    for (int o : { ROWS, COLUMNS })
+    {
+        for (int v = 1; v <= Board::SIZE; ++v)
+        {
+            unsigned const (&masks)[Board::SIZE] = masks_[o][v - 1];
+
+            unsigned eligible = 0;
+            for (int line = 0; line < Board::SIZE; ++line)
+            {
+                int n = countBits(masks[line]);
+                if (n >= 2 && n <= N)
+                    eligible |= 1u << line;
+            }
+            if (countBits(eligible) < N)
+                continue;
+
+            for (auto const & combination : COMBINATIONS<N>.table)
+            {
+                if ((combination.mask & ~eligible) != 0)
+                    continue;
+
+                unsigned cover = 0;
+                for (int line : combination.elements)
+                {
+                    cover |= masks[line];
+                }
+                if (countBits(cover) != N)
+                    continue;
+
+                // Find any candidates to eliminate
+                std::vector<int> eliminated;
+                for (int line = 0; line < Board::SIZE; ++line)
+                {
+                    if ((combination.mask & (1u << line)) != 0)
+                        continue;
+                    for (int p = 0; p < Board::SIZE; ++p)
+                    {
+                        if (masks[line] & cover & (1u << p))
+                            eliminated.push_back(cell(o, line, p));
+                    }
+                }
+
+                // If there are any candidates to eliminate then return them. Otherwise, keep looking.
+                if (!eliminated.empty())
+                {
+                    indexes = eliminated;
+                    values.push_back(v);
+                    reason = this->reason(o, v, combination.mask, cover, 0, -1);
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+template <int N>
+bool Fish<N>::finnedExists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason) const
+{
+    // For each value in rows and then in columns, if the cells of N lines with the value are in only N crossing lines except for
+    // some in one box (the fins), then the value cannot be in the cells of those N crossing lines in that box in any other lines.
+    for (int o : { ROWS, COLUMNS })
+    {
+        for (int v = 1; v <= Board::SIZE; ++v)
+        {
+            unsigned const (&masks)[Board::SIZE] = masks_[o][v - 1];
+
+            // A line with the value in more than N + 3 cells cannot be a base line, since the fins are in one box
+            unsigned eligible = 0;
+            for (int line = 0; line < Board::SIZE; ++line)
+            {
+                int n = countBits(masks[line]);
+                if (n >= 2 && n <= N + 3)
+                    eligible |= 1u << line;
+            }
+            if (countBits(eligible) < N)
+                continue;
+
+            for (auto const & combination : COMBINATIONS<N>.table)
+            {
+                if ((combination.mask & ~eligible) != 0)
+                    continue;
+
+                unsigned all = 0;
+                for (int line : combination.elements)
+                {
+                    all |= masks[line];
+                }
+                int extra = countBits(all) - N;
+                if (extra <= 0 || extra > 3)
+                    continue;
+
+                // The fins are some of the cells in one stack (the 3 crossing lines through a box), and the rest are the cover
+                for (int s = 0; s < Board::BOX_SIZE; ++s)
+                {
+                    unsigned stack = STACK << (s * Board::BOX_SIZE);
+                    if (countBits(all & ~stack) > N)
+                        continue;
+
+                    for (unsigned k = 1; k <= STACK; ++k)
+                    {
+                        unsigned fins = k << (s * Board::BOX_SIZE);
+                        if ((fins & ~all) != 0 || countBits(fins) != extra)
+                            continue;
+                        unsigned cover = all & ~fins;
+
+                        // Each base line must have a cell in the cover, and the base lines with fins must be in the same band
+                        unsigned finLines = 0;
+                        bool     covered  = true;
+                        for (int line : combination.elements)
+                        {
+                            if ((masks[line] & cover) == 0)
+                                covered = false;
+                            if ((masks[line] & fins) != 0)
+                                finLines |= 1u << line;
+                        }
+                        int band = 0;
+                        while ((finLines & (STACK << (band * Board::BOX_SIZE))) == 0)
+                        {
+                            ++band;
+                        }
+                        if (!covered || (finLines & ~(STACK << (band * Board::BOX_SIZE))) != 0)
+                            continue;
+
+                        // Find any candidates to eliminate in the cover lines in the fins' box
+                        std::vector<int> eliminated;
+                        for (int line = band * Board::BOX_SIZE; line < (band + 1) * Board::BOX_SIZE; ++line)
+                        {
+                            if ((combination.mask & (1u << line)) != 0)
+                                continue;
+                            for (int p = 0; p < Board::SIZE; ++p)
+                            {
+                                if (masks[line] & cover & stack & (1u << p))
+                                    eliminated.push_back(cell(o, line, p));
+                            }
+                        }
+
+                        // If there are any candidates to eliminate then return them. Otherwise, keep looking.
+                        if (!eliminated.empty())
+                        {
+                            int box = (o == ROWS) ? band * Board::BOX_SIZE + s : s * Board::BOX_SIZE + band;
+                            indexes = eliminated;
+                            values.push_back(v);
+                            reason = this->reason(o, v, combination.mask, cover, fins, box);
+                            return true;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return false;
+}
+
+template <int N>
+std::string Fish<N>::reason(int o, int v, unsigned base, unsigned cover, unsigned fins, int box) const
+{
+    std::string baseType  = (o == ROWS) ? "row" : "column";
+    std::string coverType = (o == ROWS) ? "column" : "row";
+
+    // List the cells with the value in the cover of each base line, and the fins
+    std::vector<std::string> lines;
+    std::vector<std::string> finNames;
+    for (int line = 0; line < Board::SIZE; ++line)
+    {
+        if ((base & (1u << line)) == 0)
+            continue;
+
+        std::vector<std::string> names;
+        for (int p = 0; p < Board::SIZE; ++p)
+        {
+            if (masks_[o][v - 1][line] & cover & (1u << p))
+                names.push_back(Board::Cell::name(cell(o, line, p)));
+            if (masks_[o][v - 1][line] & fins & (1u << p))
+                finNames.push_back(Board::Cell::name(cell(o, line, p)));
+        }
+        char lineName = (o == ROWS) ? Board::Group::rowName(line) : Board::Group::columnName(line);
+        lines.push_back(list(names) + " in " + baseType + " " + lineName);
+    }
+
+    std::vector<std::string> coverNames;
+    for (int p = 0; p < Board::SIZE; ++p)
+    {
+        if (cover & (1u << p))
+            coverNames.emplace_back(1, (o == ROWS) ? Board::Group::columnName(p) : Board::Group::rowName(p));
+    }
+
+    std::string reason;
+    if (fins == 0)
+        reason = "Only ";
+    else
+        reason = "Except for " + list(finNames) + " in " + Positions::name(Positions::box(box)) + ", only ";
+    reason += list(lines) + " can have the value " + std::to_string(v) +
+              ". These squares are in the same " + NUMBERS[N] + " " + coverType + "s, " + list(coverNames) + ". ";
+    if (fins == 0)
+    {
+        reason += "One of these squares in each " + coverType + " must have this value and so the other squares in these " +
+                  coverType + "s cannot.";
+    }
+    else
+    {
+        reason += "Either one of the squares in " + Positions::name(Positions::box(box)) + " has this value or one of these squares" +
+                  " in each " + coverType + " does, and so the other squares in these " + coverType + "s in that box cannot.";
+    }
+    return reason;
+}
+
+template class Fish<2>;
+template class Fish<3>;
+template class Fish<4>;
@@ -0,0 +1,60 @@
+#if !defined(ANALYZER_FISH_H_INCLUDED)
+#define ANALYZER_FISH_H_INCLUDED 1
+#pragma once
+
+#include "Board/Board.h"
+#include "LinkGraph.h"
+
+#include <string>
+#include <vector>
+
+// Finds fish of size N (x-wings, swordfish and jellyfish), and finned and sashimi fish.
+//
+// A fish is N rows (or columns), the base lines, in which a value can only be in the same N columns (or rows), the cover lines. The
+// value must be in one of the cells of each base line, so it cannot be anywhere else in the cover lines. For each value, the cells
+// of each line with the value are a 9-bit mask, so a fish is a combination of N base lines whose masks together have exactly N bits.
+//
+// A finned fish also has the value in other cells of the base lines (the fins), all in one box. Either a fin has the value or the
+// fish does, so the value can be eliminated only from the cells of the cover lines in the fins' box. A sashimi fish is a finned fish
+// with only one cell of a base line in the cover lines.
+template <int N>
+class Fish
+{
+public:
+    static_assert(N >= 2 && N <= 4, "Only x-wings, swordfish and jellyfish are supported");
+
+    // Constructor
+    explicit Fish(LinkGraph const & links);
+
+    // Returns true if a fish exists and candidates can be eliminated because of it
+    // Returns the indexes and values to eliminate and a description
+    bool exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason) const;
+
+    // Returns true if a finned or sashimi fish exists and candidates can be eliminated because of it
+    // Returns the indexes and values to eliminate and a description
+    bool finnedExists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason) const;
+
+private:
+    // Whether the base lines are rows or columns
+    enum Orientation
+    {
+        ROWS,
+        COLUMNS
+    };
+
+    // Returns the index of the cell at the given position in a line
+    static int cell(int o, int line, int position)
+    {
+        return (o == ROWS) ? Board::Cell::indexOf(line, position) : Board::Cell::indexOf(position, line);
+    }
+
+    std::string reason(int o, int v, unsigned base, unsigned cover, unsigned fins, int box) const;
+
+    unsigned masks_[2][Board::SIZE][Board::SIZE];   // Positions of each value (- 1) in each line, for each orientation
+};
+
+using XWing     = Fish<2>;
+using Swordfish = Fish<3>;
+using Jellyfish = Fish<4>;
+
+#endif // defined(ANALYZER_FISH_H_INCLUDED)
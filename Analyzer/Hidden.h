@@ -4,6 +4,7 @@
 
 #include "Board/Board.h"
 #include "Candidates.h"
+#include "Positions.h"
 
 #include <string>
 #include <vector>
@@ -11,15 +12,19 @@
 class Hidden
 {
 public:
-    Hidden(Board const & board, Candidates::List const & candidates)
+    Hidden(Board const & board, Candidates::List const & candidates, Positions const & positions)
         : board_(board)
         , candidates_(candidates)
+        , positions_(positions)
     {
     }
 
     // Returns true if a hidden single exists
     bool singleExists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason);
 
+    // Returns true if a hidden single exists in group g (see Positions)
+    bool singleExists(int g, std::vector<int> & indexes, std::vector<int> & values, std::string & reason);
+
     // Returns true if a hidden pair exists
     bool pairExists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason);
 
@@ -30,24 +35,11 @@ public:
     bool quadExists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason);
 
 private:
-    bool single(std::vector<int> const & indexes,
-                std::vector<int> &       eliminatedIndexes,
-                std::vector<int> &       eliminatedValues);
-    bool pair(std::vector<int> const & indexes,
-              std::vector<int> &       eliminatedIndexes,
-              std::vector<int> &       eliminatedValues,
-              std::vector<int> &       hiddenValues);
-    bool triple(std::vector<int> const & indexes,
-                std::vector<int> &       eliminatedIndexes,
-                std::vector<int> &       eliminatedValues,
-                std::vector<int> &       hiddenValues);
-    bool quad(std::vector<int> const & indexes,
-              std::vector<int> &       eliminatedIndexes,
-              std::vector<int> &       eliminatedValues,
-              std::vector<int> &       hiddenValues);
+    bool single(int g, std::vector<int> & hiddenIndexes, std::vector<int> & hiddenValues);
 
     Board const & board_;
     Candidates::List const & candidates_;
+    Positions const & positions_;
 };
 
 #endif // defined(ANALYZER_HIDDEN_H_INCLUDED)
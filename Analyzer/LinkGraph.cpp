@@ -0,0 +1,151 @@
+#include "LinkGraph.h"
+
+#include "Bitboard.h"
+#include "Candidates.h"
+#include "Positions.h"
+
+#include "Board/Board.h"
+
+namespace
+{
+// Returns the groups (see Positions) containing cell i
+void groupsOf(int i, int (&groups)[3])
+{
+    groups[0] = Positions::row(Board::Group::whichRow(i));
+    groups[1] = Positions::column(Board::Group::whichColumn(i));
+    groups[2] = Positions::box(Board::Group::whichBox(i));
+}
+
+// Returns the two values of bivalue candidates
+void pairOf(Candidates::Type c, int (&pair)[2])
+{
+    int n = 0;
+    for (int v = 1; v <= Board::SIZE; ++v)
+    {
+        if (Candidates::includes(c, v))
+            pair[n++] = v;
+    }
+}
+} // anonymous namespace
+
+LinkGraph::LinkGraph()
+{
+    // Every cell has every value, so there are no conjugate pairs and no bivalue cells
+    for (auto & cells : cells_)
+    {
+        cells = Bitboard::all();
+    }
+}
+
+LinkGraph::LinkGraph(Candidates::List const & candidates)
+    : LinkGraph()
+{
+    XCODE_COMPATIBLE_ASSERT(candidates.size() == Board::NUM_CELLS);
+
+    for (int i = 0; i < Board::NUM_CELLS; ++i)
+    {
+        update(i, candidates[i]);
+    }
+}
+
+void LinkGraph::update(int i, Candidates::Type c)
+{
+    XCODE_COMPATIBLE_ASSERT(i >= 0 && i < Board::NUM_CELLS);
+
+    // If the cell was a bivalue, then remove it from the index of its old pair, which is the values it still has in cells_
+    int pair[2];
+    if (bivalues_.test(i))
+    {
+        Candidates::Type old = Candidates::NONE;
+        for (int v = 1; v <= Board::SIZE; ++v)
+        {
+            if (cells_[v - 1].test(i))
+                old |= Candidates::fromValue(v);
+        }
+        pairOf(old, pair);
+        pairs_[pair[0] - 1][pair[1] - 1].reset(i);
+        pairs_[pair[1] - 1][pair[0] - 1].reset(i);
+    }
+
+    if (c != Candidates::NONE && Candidates::isBivalue(c))
+    {
+        pairOf(c, pair);
+        bivalues_.set(i);
+        pairs_[pair[0] - 1][pair[1] - 1].set(i);
+        pairs_[pair[1] - 1][pair[0] - 1].set(i);
+    }
+    else
+    {
+        bivalues_.reset(i);
+    }
+
+    bool multiple = (c != Candidates::NONE) && !Candidates::isSolved(c);
+    int  groups[3];
+    groupsOf(i, groups);
+    for (int v = 1; v <= Board::SIZE; ++v)
+    {
+        Bitboard & cells = cells_[v - 1];
+        bool       has   = multiple && Candidates::includes(c, v);
+        if (cells.test(i) == has)
+            continue;
+
+        if (has)
+            cells.set(i);
+        else
+            cells.reset(i);
+
+        // A conjugate pair in one of the cell's groups may have been formed or broken, in which case the strong links of every cell
+        // in the group with the value (and of this cell) must be updated.
+        for (int g : groups)
+        {
+            Bitboard members = cells & Bitboard::group(g);
+            bool     pair    = members.count() == 2;
+            bool     wasPair = (conjugates_[v - 1] & (1u << g)) != 0;
+            if (!pair && !wasPair)
+                continue;
+
+            conjugates_[v - 1] ^= 1u << g;
+            members.set(i);
+            while (!members.empty())
+            {
+                updateStrong(members.pop(), v);
+            }
+        }
+    }
+}
+
+Bitboard LinkGraph::weak(int i, int v) const
+{
+    XCODE_COMPATIBLE_ASSERT(i >= 0 && i < Board::NUM_CELLS);
+    XCODE_COMPATIBLE_ASSERT(v >= 1 && v <= Board::SIZE);
+
+    // The cell is weakly linked to the other cells with the value in each of its groups, but only if there is more than one
+    Bitboard links;
+    int      groups[3];
+    groupsOf(i, groups);
+    for (int g : groups)
+    {
+        Bitboard others = cells_[v - 1] & Bitboard::group(g);
+        others.reset(i);
+        if (others.count() > 1)
+            links |= others;
+    }
+    return links;
+}
+
+void LinkGraph::updateStrong(int i, int v)
+{
+    Bitboard links;
+    if (cells_[v - 1].test(i))
+    {
+        int groups[3];
+        groupsOf(i, groups);
+        for (int g : groups)
+        {
+            if (conjugates_[v - 1] & (1u << g))
+                links |= cells_[v - 1] & Bitboard::group(g);
+        }
+        links.reset(i);
+    }
+    strong_[v - 1][i] = links;
+}
@@ -0,0 +1,74 @@
+#if !defined(ANALYZER_LINKGRAPH_H_INCLUDED)
+#define ANALYZER_LINKGRAPH_H_INCLUDED 1
+#pragma once
+
+#include "Bitboard.h"
+#include "Board/Board.h"
+#include "Candidates.h"
+
+// The strong and weak links between the cells with each value, kept up to date as candidates are eliminated.
+//
+// Only cells with more than one candidate take part in links. Two cells are strongly linked for a value if they are the only two
+// such cells with the value in a row, column or box (a conjugate pair). Two cells are weakly linked for a value if they share a row,
+// column or box in which more than two cells have the value. These are the same links as those found by Link::Strong::find and
+// Link::Weak::find for a single cell and value, but as sets of cells, so the chaining and coloring techniques can follow them
+// without building lists. The bivalue cells are also indexed by their pair of candidates, for the wing techniques.
+class LinkGraph
+{
+public:
+    // Constructs the graph with every value possible in every cell
+    LinkGraph();
+
+    // Constructs the graph corresponding to the given candidates
+    explicit LinkGraph(Candidates::List const & candidates);
+
+    // Updates the graph after the candidates of cell i have changed
+    void update(int i, Candidates::Type c);
+
+    // Returns the cells that have value v and at least one other candidate
+    Bitboard const & cells(int v) const
+    {
+        XCODE_COMPATIBLE_ASSERT(v >= 1 && v <= Board::SIZE);
+        return cells_[v - 1];
+    }
+
+    // Returns the groups (see Positions) in which value v is in exactly two cells, as a mask of (1 << group)
+    unsigned conjugates(int v) const
+    {
+        XCODE_COMPATIBLE_ASSERT(v >= 1 && v <= Board::SIZE);
+        return conjugates_[v - 1];
+    }
+
+    // Returns the cells that are strongly linked to cell i for value v
+    Bitboard const & strong(int i, int v) const
+    {
+        XCODE_COMPATIBLE_ASSERT(i >= 0 && i < Board::NUM_CELLS);
+        XCODE_COMPATIBLE_ASSERT(v >= 1 && v <= Board::SIZE);
+        return strong_[v - 1][i];
+    }
+
+    // Returns the cells that are weakly linked to cell i for value v
+    Bitboard weak(int i, int v) const;
+
+    // Returns the cells that have exactly two candidates
+    Bitboard const & bivalues() const { return bivalues_; }
+
+    // Returns the cells whose only candidates are v0 and v1
+    Bitboard const & bivalues(int v0, int v1) const
+    {
+        XCODE_COMPATIBLE_ASSERT(v0 >= 1 && v0 <= Board::SIZE);
+        XCODE_COMPATIBLE_ASSERT(v1 >= 1 && v1 <= Board::SIZE);
+        return pairs_[v0 - 1][v1 - 1];
+    }
+
+private:
+    void updateStrong(int i, int v);
+
+    Bitboard cells_[Board::SIZE];                       // Cells with each value and at least one other candidate
+    unsigned conjugates_[Board::SIZE] = {};             // Groups with exactly two cells with each value
+    Bitboard strong_[Board::SIZE][Board::NUM_CELLS];    // Cells strongly linked to each cell for each value
+    Bitboard bivalues_;                                 // Cells with exactly two candidates
+    Bitboard pairs_[Board::SIZE][Board::SIZE];          // Cells with exactly two candidates, by candidate pair (in either order)
+};
+
+#endif // defined(ANALYZER_LINKGRAPH_H_INCLUDED)
@@ -1,12 +1,64 @@
 #include "LockedCandidates.h"
 
+#include "Bitboard.h"
+#include "LinkGraph.h"
+
 #include "Board/Board.h"
 
-#include <algorithm>
-#include <iterator>
+#include <array>
 #include <string>
 #include <vector>
 
+namespace
+{
+// The intersection of a row or column with a box
+struct Intersection
+{
+    bool     column;    // True if the line is a column
+    int      line;      // Row or column
+    int      box;       // Box
+    Bitboard cells;     // Cells in both the line and the box
+    Bitboard lineRest;  // Other cells in the line
+    Bitboard boxRest;   // Other cells in the box
+};
+
+int constexpr NUM_LINE_INTERSECTIONS = Board::SIZE * Board::BOX_SIZE;  // Number of intersections of the rows (or columns)
+int constexpr NUM_INTERSECTIONS      = NUM_LINE_INTERSECTIONS * 2;     // Rows first, then columns
+
+// Returns the intersections. Intersection k is with line k / 3, and with the box in the line's k % 3 segment.
+constexpr std::array<Intersection, NUM_INTERSECTIONS> makeIntersections()
+{
+    std::array<Intersection, NUM_INTERSECTIONS> intersections{};
+    for (int k = 0; k < NUM_INTERSECTIONS; ++k)
+    {
+        Intersection & x = intersections[k];
+        x.column = k >= NUM_LINE_INTERSECTIONS;
+        x.line   = (k % NUM_LINE_INTERSECTIONS) / Board::BOX_SIZE;
+
+        int segment = k % Board::BOX_SIZE;
+        int band    = x.line / Board::BOX_SIZE;
+        x.box = x.column ? segment * Board::BOX_SIZE + band : band * Board::BOX_SIZE + segment;
+
+        for (int i = 0; i < Board::NUM_CELLS; ++i)
+        {
+            int  r      = i / Board::SIZE;
+            int  c      = i % Board::SIZE;
+            bool inLine = (x.column ? c : r) == x.line;
+            bool inBox  = (r / Board::BOX_SIZE) * Board::BOX_SIZE + c / Board::BOX_SIZE == x.box;
+            if (inLine && inBox)
+                x.cells = x.cells | Bitboard::cell(i);
+            else if (inLine)
+                x.lineRest = x.lineRest | Bitboard::cell(i);
+            else if (inBox)
+                x.boxRest = x.boxRest | Bitboard::cell(i);
+        }
+    }
+    return intersections;
+}
+
+constexpr std::array<Intersection, NUM_INTERSECTIONS> INTERSECTIONS = makeIntersections();
+} // anonymous namespace
+
 std::string LockedCandidates::generateReason(std::string const & group1,
                                              char                which1,
                                              std::string const & group2,
@@ -31,162 +83,67 @@ bool LockedCandidates::exists(std::vector<int> & indexes,
                               std::vector<int> & values,
                               std::string &      reason)
 {
-    // For the intersection of each row or column with a box, if there are candidates that exist within the intersection but not in
-    // the rest of the row/column, then success if those candidates exist in the box.
-
-    bool found;
-    int  which1, which2;
-
-    found = !Board::ForEach::row([&](int r, std::vector<int> const & row) {
-                                     for (int c = 0; c < Board::SIZE; c += Board::BOX_SIZE)
-                                     {
-                                         int b = Board::Group::whichBox(r, c);
-                                         std::vector<int> box = Board::Group::box(b);
-                                         if (find(row, box, indexes, values))
-                                         {
-                                             which1 = r;
-                                             which2 = b;
-                                             return false; // done
-                                         }
-                                     }
-                                     return true;
-                                 });
-    if (found)
-    {
-        reason = generateReason("row", Board::Group::rowName(which1), "box", Board::Group::boxName(which2));
-        return true;
-    }
-
-    found = !Board::ForEach::column([&](int c, std::vector<int> const & column) {
-                                        for (int r = 0; r < Board::SIZE; r += Board::BOX_SIZE)
-                                        {
-                                            int b = Board::Group::whichBox(r, c);
-                                            std::vector<int> box = Board::Group::box(b);
-                                            if (find(column, box, indexes, values))
-                                            {
-                                                which1 = c;
-                                                which2 = b;
-                                                return false; // done
-                                            }
-                                        }
-                                        return true;
-                                    });
-    if (found)
-    {
-        reason = generateReason("column", Board::Group::columnName(which1), "box", Board::Group::boxName(which2));
-        return true;
-    }
-
-    // For the intersection of each row or column with a box, if there are candidates that exist within the intersection but not in
-    // the rest of the box, then success if those candidates exist in the row/column.
-
-    found = !Board::ForEach::row([&](int r, std::vector<int> const & row) {
-                                     for (int c = 0; c < Board::SIZE; c += Board::BOX_SIZE)
-                                     {
-                                         int b = Board::Group::whichBox(r, c);
-                                         std::vector<int> box = Board::Group::box(b);
-                                         if (find(box, row, indexes, values))
-                                         {
-                                             which1 = b;
-                                             which2 = r;
-                                             return false; // done
-                                         }
-                                     }
-                                     return true;
-                                 });
-    if (found)
+    // In one pass over the values, find the values locked in each intersection by its line (claiming) and by its box (pointing),
+    // along with the cells they can be eliminated from.
+    Candidates::Type claimed[NUM_INTERSECTIONS]  = {};
+    Candidates::Type pointing[NUM_INTERSECTIONS] = {};
+    Bitboard         boxEliminations[NUM_INTERSECTIONS];
+    Bitboard         lineEliminations[NUM_INTERSECTIONS];
+    for (int v = 1; v <= Board::SIZE; ++v)
     {
-        reason = generateReason("box", Board::Group::boxName(which1), "row", Board::Group::rowName(which2));
-        return true;
+        Bitboard const & cells = links_.cells(v);
+        for (int k = 0; k < NUM_INTERSECTIONS; ++k)
+        {
+            Intersection const & x = INTERSECTIONS[k];
+            if ((cells & x.cells).empty())
+                continue;
+
+            Bitboard inLine = cells & x.lineRest;
+            Bitboard inBox  = cells & x.boxRest;
+            if (inLine.empty())
+            {
+                claimed[k]         |= Candidates::fromValue(v);
+                boxEliminations[k] |= inBox;
+            }
+            if (inBox.empty())
+            {
+                pointing[k]         |= Candidates::fromValue(v);
+                lineEliminations[k] |= inLine;
+            }
+        }
     }
 
-    found = !Board::ForEach::column([&](int c, std::vector<int> const & column) {
-                                        for (int r = 0; r < Board::SIZE; r += Board::BOX_SIZE)
-                                        {
-                                            int b = Board::Group::whichBox(r, c);
-                                            std::vector<int> box = Board::Group::box(b);
-                                            if (find(box, column, indexes, values))
-                                            {
-                                                which1 = b;
-                                                which2 = c;
-                                                return false; // done
-                                            }
-                                        }
-                                        return true;
-                                    });
-    if (found)
+    // For the intersection of each row and then each column with a box, if there are candidates that exist within the intersection
+    // but not in the rest of the row/column, then success if those candidates exist in the rest of the box.
+    for (int k = 0; k < NUM_INTERSECTIONS; ++k)
     {
-        reason = generateReason("box", Board::Group::boxName(which1), "row", Board::Group::columnName(which2));
-        return true;
+        Intersection const & x = INTERSECTIONS[k];
+        if (!boxEliminations[k].empty())
+        {
+            indexes = boxEliminations[k].indexes();
+            values  = Candidates::values(claimed[k]);
+            reason  = x.column
+                      ? generateReason("column", Board::Group::columnName(x.line), "box", Board::Group::boxName(x.box))
+                      : generateReason("row", Board::Group::rowName(x.line), "box", Board::Group::boxName(x.box));
+            return true;
+        }
     }
 
-    return false;
-}
-
-bool LockedCandidates::find(std::vector<int> const & indexes1,
-                            std::vector<int> const & indexes2,
-                            std::vector<int> &       eliminatedIndexes,
-                            std::vector<int> &       eliminatedValues)
-{
-    // Indexes in the intersection
-    std::vector<int> intersection;
-    std::set_intersection(indexes1.begin(), indexes1.end(),
-                          indexes2.begin(), indexes2.end(),
-                          std::back_inserter(intersection));
-
-    // Indexes not in the intersection
-    std::vector<int> others1;
-    std::set_difference(indexes1.begin(), indexes1.end(),
-                        intersection.begin(), intersection.end(),
-                        std::back_inserter(others1));
-    std::vector<int> others2;
-    std::set_difference(indexes2.begin(), indexes2.end(),
-                        intersection.begin(), intersection.end(),
-                        std::back_inserter(others2));
-
-    // Candidates in the intersection
-    Candidates::Type intersectionCandidates = allCandidates(intersection);
-
-    // Candidates in set 1, not in intersection
-    Candidates::Type otherCandidates1 = allCandidates(others1);
-
-    // If any of the candidates in the intersection don't exist in the rest of set 1, then they are the ones to be eliminated from
-    // set 2
-    Candidates::Type unique1 = intersectionCandidates & ~otherCandidates1;
-    if (unique1)
+    // For the intersection of each row and then each column with a box, if there are candidates that exist within the intersection
+    // but not in the rest of the box, then success if those candidates exist in the rest of the row/column.
+    for (int k = 0; k < NUM_INTERSECTIONS; ++k)
     {
-        for (auto i : others2)
-        {
-            if (candidates_[i] & unique1)
-                eliminatedIndexes.push_back(i);
-        }
-        if (!eliminatedIndexes.empty())
+        Intersection const & x = INTERSECTIONS[k];
+        if (!lineEliminations[k].empty())
         {
-            std::vector<int> uniqueCandidates = Candidates::values(unique1);
-            eliminatedValues.insert(eliminatedValues.end(), uniqueCandidates.begin(), uniqueCandidates.end());
+            indexes = lineEliminations[k].indexes();
+            values  = Candidates::values(pointing[k]);
+            reason  = x.column
+                      ? generateReason("box", Board::Group::boxName(x.box), "column", Board::Group::columnName(x.line))
+                      : generateReason("box", Board::Group::boxName(x.box), "row", Board::Group::rowName(x.line));
+            return true;
         }
-
-        std::sort(eliminatedIndexes.begin(), eliminatedIndexes.end());
-        eliminatedIndexes.erase(std::unique(eliminatedIndexes.begin(),
-                                            eliminatedIndexes.end()),
-                                eliminatedIndexes.end());
-        std::sort(eliminatedValues.begin(), eliminatedValues.end());
-        eliminatedValues.erase(std::unique(eliminatedValues.begin(),
-                                           eliminatedValues.end()),
-                               eliminatedValues.end());
     }
 
-    return !eliminatedIndexes.empty();
-}
-
-Candidates::Type LockedCandidates::allCandidates(std::vector<int> const & indexes)
-{
-    Candidates::Type all = 0;
-    for (auto i : indexes)
-    {
-        Candidates::Type c = candidates_[i];
-        if (!Candidates::isSolved(c))
-            all |= c;
-    }
-    return all;
+    return false;
 }
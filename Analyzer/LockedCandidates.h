@@ -3,28 +3,27 @@
 #pragma once
 
 #include "Candidates.h"
+#include "LinkGraph.h"
 #include <string>
 #include <vector>
 
+// Finds locked candidates in the 54 intersections of a row or column with a box.
+//
+// If a value in a line can only be in the line's intersection with a box, then it cannot be anywhere else in the box (claiming).
+// If a value in a box can only be in the box's intersection with a line, then it cannot be anywhere else in the line (pointing).
+// Each intersection and the rest of its line and box are precomputed bitboards, so both are tests of the value's cells.
 class LockedCandidates
 {
 public:
-    LockedCandidates(Candidates::List const & candidates) : candidates_(candidates) {}
+    LockedCandidates(LinkGraph const & links) : links_(links) {}
 
     // Returns true if locked candidates exist
     bool exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason);
 
 private:
-    bool find(std::vector<int> const & indexes1,
-              std::vector<int> const & indexes2,
-              std::vector<int> &       eliminatedIndexes,
-              std::vector<int> &       eliminatedValues);
     static std::string generateReason(std::string const & group1, char which1, std::string const & group2, char which2);
 
-    // Returns all unsolved candidates in the cells specified by the indexes
-    Candidates::Type allCandidates(std::vector<int> const & indexes);
-
-    Candidates::List const & candidates_;
+    LinkGraph const & links_;
 };
 
 #endif // defined(ANALYZER_LOCKEDCANDIDATES_H_INCLUDED)
@@ -16,6 +16,9 @@ public:
     // Returns true if a naked single exists
     bool singleExists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason);
 
+    // Returns true if cell i is a naked single
+    bool singleExists(int i, std::vector<int> & indexes, std::vector<int> & values, std::string & reason);
+
     // Returns true if a naked pair exists
     bool pairExists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason);
 
@@ -26,24 +29,6 @@ public:
     bool quadExists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason);
 
 private:
-    bool single(std::vector<int> & nakedIndexes, std::vector<int> & nakedValues);
-    bool pair(std::vector<int> const & group,
-              std::vector<int> &       eliminatedIndexes,
-              std::vector<int> &       eliminatedValues,
-              std::vector<int> &       nakedIndexes);
-    bool triple(std::vector<int> const & group,
-                std::vector<int> &       eliminatedIndexes,
-                std::vector<int> &       eliminatedValues,
-                std::vector<int> &       nakedIndexes);
-    bool quad(std::vector<int> const & group,
-              std::vector<int> &       eliminatedIndexes,
-              std::vector<int> &       eliminatedValues,
-              std::vector<int> &       nakedIndexes);
-
-    static std::string pairReason(std::string const & group, char which, std::vector<int> const & indexes);
-    static std::string tripleReason(std::string const & group, char which, std::vector<int> const & indexes);
-    static std::string quadReason(std::string const & group, char which, std::vector<int> const & indexes);
-
     Board const & board_;
     Candidates::List const & candidates_;
 };
@@ -0,0 +1,85 @@
+#include "Positions.h"
+
+#include "Candidates.h"
+
+#include "Board/Board.h"
+
+#include <string>
+#include <vector>
+
+Positions::Positions()
+{
+    for (auto & group : masks_)
+    {
+        for (auto & mask : group)
+        {
+            mask = ALL;
+        }
+    }
+}
+
+Positions::Positions(Candidates::List const & candidates)
+    : masks_()
+{
+    XCODE_COMPATIBLE_ASSERT(candidates.size() == Board::NUM_CELLS);
+
+    for (int g = 0; g < NUM_GROUPS; ++g)
+    {
+        std::vector<int> const & cells = indexes(g);
+        for (int k = 0; k < Board::SIZE; ++k)
+        {
+            Candidates::Type c = candidates[cells[k]];
+            for (int v = 1; v <= Board::SIZE; ++v)
+            {
+                if (Candidates::includes(c, v))
+                    masks_[g][v - 1] |= 1u << k;
+            }
+        }
+    }
+}
+
+void Positions::eliminate(int i, int v)
+{
+    XCODE_COMPATIBLE_ASSERT(v >= 1 && v <= Board::SIZE);
+
+    masks_[row(Board::Group::whichRow(i))][v - 1]       &= ~(1u << Board::Group::offsetInRow(i));
+    masks_[column(Board::Group::whichColumn(i))][v - 1] &= ~(1u << Board::Group::offsetInColumn(i));
+    masks_[box(Board::Group::whichBox(i))][v - 1]       &= ~(1u << Board::Group::offsetInBox(i));
+}
+
+void Positions::update(int i, Candidates::Type from, Candidates::Type to)
+{
+    int r = row(Board::Group::whichRow(i));
+    int c = column(Board::Group::whichColumn(i));
+    int b = box(Board::Group::whichBox(i));
+    for (int v : Candidates::values(from ^ to))
+    {
+        masks_[r][v - 1] ^= 1u << Board::Group::offsetInRow(i);
+        masks_[c][v - 1] ^= 1u << Board::Group::offsetInColumn(i);
+        masks_[b][v - 1] ^= 1u << Board::Group::offsetInBox(i);
+    }
+}
+
+std::vector<int> const & Positions::indexes(int g)
+{
+    XCODE_COMPATIBLE_ASSERT(g >= 0 && g < NUM_GROUPS);
+
+    if (g < Board::SIZE)
+        return Board::Group::row(g);
+    else if (g < Board::SIZE * 2)
+        return Board::Group::column(g - Board::SIZE);
+    else
+        return Board::Group::box(g - Board::SIZE * 2);
+}
+
+std::string Positions::name(int g)
+{
+    XCODE_COMPATIBLE_ASSERT(g >= 0 && g < NUM_GROUPS);
+
+    if (g < Board::SIZE)
+        return std::string("row ") + Board::Group::rowName(g);
+    else if (g < Board::SIZE * 2)
+        return std::string("column ") + Board::Group::columnName(g - Board::SIZE);
+    else
+        return std::string("box ") + Board::Group::boxName(g - Board::SIZE * 2);
+}
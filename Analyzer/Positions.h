@@ -0,0 +1,67 @@
+#if !defined(ANALYZER_POSITIONS_H_INCLUDED)
+#define ANALYZER_POSITIONS_H_INCLUDED 1
+#pragma once
+
+#include "Board/Board.h"
+#include "Candidates.h"
+
+#include <string>
+#include <vector>
+
+// The cells in each group in which each value can be, as masks of (1 << offset in the group).
+//
+// This is the transpose of the candidates of the cells in each group. It is kept up to date as candidates are eliminated, so that
+// techniques concerned with where a value can be in a group (hidden singles and subsets, for example) do not have to scan the cells.
+class Positions
+{
+public:
+    static int constexpr NUM_GROUPS = Board::SIZE * 3;  // Number of groups (rows, then columns, then boxes)
+    static unsigned constexpr ALL   = 0x1ff;            // Mask of every cell in a group
+
+    // Constructs the positions with every value possible in every cell
+    Positions();
+
+    // Constructs the positions corresponding to the given candidates
+    explicit Positions(Candidates::List const & candidates);
+
+    // Removes a value as a possibility for a cell
+    void eliminate(int i, int v);
+
+    // Updates a cell after its candidates have changed
+    void update(int i, Candidates::Type from, Candidates::Type to);
+
+    // Returns the cells in group g in which value v can be
+    unsigned get(int g, int v) const
+    {
+        XCODE_COMPATIBLE_ASSERT(g >= 0 && g < NUM_GROUPS);
+        XCODE_COMPATIBLE_ASSERT(v >= 1 && v <= Board::SIZE);
+        return masks_[g][v - 1];
+    }
+
+    // Returns the masks of each value in group g, indexed by value - 1
+    unsigned const (&group(int g) const)[Board::SIZE]
+    {
+        XCODE_COMPATIBLE_ASSERT(g >= 0 && g < NUM_GROUPS);
+        return masks_[g];
+    }
+
+    // Returns the group number of a row
+    static int row(int r) { return r; }
+
+    // Returns the group number of a column
+    static int column(int c) { return Board::SIZE + c; }
+
+    // Returns the group number of a box
+    static int box(int b) { return Board::SIZE * 2 + b; }
+
+    // Returns the indexes of the cells in group g
+    static std::vector<int> const & indexes(int g);
+
+    // Returns the name of group g (for example, "row A")
+    static std::string name(int g);
+
+private:
+    unsigned masks_[NUM_GROUPS][Board::SIZE];
+};
+
+#endif // defined(ANALYZER_POSITIONS_H_INCLUDED)
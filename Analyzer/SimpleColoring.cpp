@@ -1,75 +1,108 @@
 #include "SimpleColoring.h"
 
-#include "Candidates.h"
-#include "Link.h"
+#include "Bitboard.h"
+#include "LinkGraph.h"
+#include "Positions.h"
 
 #include "Board/Board.h"
 
 #include <algorithm>
 #include <iterator>
-#include <set>
 #include <string>
 #include <vector>
 
+namespace
+{
+// Cells joined into clusters by strong links, keeping the parity of each cell's color relative to the root of its cluster
+class Clusters
+{
+public:
+    Clusters()
+    {
+        for (int i = 0; i < Board::NUM_CELLS; ++i)
+        {
+            parent_[i] = i;
+        }
+    }
+
+    // Returns the root of the cell's cluster, and the parity of the cell's color relative to the root's
+    int find(int i, int & parity)
+    {
+        if (parent_[i] == i)
+        {
+            parity = 0;
+            return i;
+        }
+
+        int parentParity;
+        int root    = find(parent_[i], parentParity);
+        parent_[i]  = root;
+        parity_[i] ^= parentParity;
+        parity      = parity_[i];
+        return root;
+    }
+
+    // Joins the clusters of two strongly-linked cells, which have opposite colors
+    void join(int i0, int i1)
+    {
+        int parity0;
+        int parity1;
+        int root0 = find(i0, parity0);
+        int root1 = find(i1, parity1);
+        if (root0 != root1)
+        {
+            parent_[root1] = root0;
+            parity_[root1] = parity0 ^ parity1 ^ 1;
+        }
+    }
+
+private:
+    int parent_[Board::NUM_CELLS];
+    int parity_[Board::NUM_CELLS] = {};
+};
+} // anonymous namespace
+
 bool SimpleColoring::exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason)
 {
-    // For each candidate in each cell that has not already been checked:
-    //  Form a graph of strong links of the candidate value rooted at the cell.
-    //  1. If two cells in the graph can see each other and the inference of their values are the same, then there is a
-    // contradiction.
-    // The only possibility is that none of the cells in the graph with the same inference as those two cells can have that
-    // candidate.
-    //  2. If any cell with the candidate can see cells in the graph with opposite inferences, then it cannot be a candidate.
+    // For each cluster of cells with a candidate value connected by strong links:
+    //  The cells of the cluster are colored with alternating red and green along the links.
+    //  1. If two cells of the same color can see each other, then there is a contradiction.
+    // The only possibility is that none of the cells with that color can have that candidate.
+    //  2. If any cell with the candidate can see cells in the cluster with both colors, then it cannot be a candidate.
 
     for (int v = 1; v <= 9; ++v)
     {
-        std::vector<bool> alreadyChecked(Board::NUM_CELLS, false);
-        for (int i = 0; i < Board::NUM_CELLS; ++i)
+        for (auto const & cluster : findClusters(v))
         {
-            Candidates::Type c = candidates_[i];
-            if (!Candidates::includes(c, v) || Candidates::isSolved(c) || alreadyChecked[i])
+            // A cell without strong links is a cluster with only one color and nothing can be eliminated because of it
+            if (cluster.green.empty())
                 continue;
 
-            // Separate strong-linked cells into alternating red and green
-            std::set<int> red;
-            std::set<int> green;
-            createGraph(v, i, red, green);
-
-            // Optimization: Ensure that the linked cells are not checked for this value again.
-            for (auto i : red)
-            {
-                alreadyChecked[i] = true;
-            }
-            for (auto i : green)
-            {
-                alreadyChecked[i] = true;
-            }
-
             // If any red cell can see any other red cell, then the value cannot be a candidate in any red cells
             std::vector<int> collisions;
-            if (collisionsFound(red, collisions))
+            if (collisionsFound(cluster.red, collisions))
             {
-                indexes.insert(indexes.end(), red.begin(), red.end());
+                indexes = cluster.red.indexes();
                 values.push_back(v);
-                reason = generateReason(v, collisions, red);
+                reason = generateReason(v, collisions);
                 return true;
             }
 
             // If any green cell can see any other green cell, then the value cannot be a candidate in any green cells
-            if (collisionsFound(green, collisions))
+            if (collisionsFound(cluster.green, collisions))
             {
-                indexes.insert(indexes.end(), green.begin(), green.end());
+                indexes = cluster.green.indexes();
                 values.push_back(v);
-                reason = generateReason(v, collisions, green);
+                reason = generateReason(v, collisions);
                 return true;
             }
 
-            // If any cell with a candidate v not in the chain can see both a red cell and a green cell, then the cell cannot have v
-            // as a candidate
-            int other;
-            std::vector<int> redDependents;
-            std::vector<int> greenDependents;
-            if (canSeeBoth(v, red, green, other, redDependents, greenDependents))
+            // If any cell with a candidate v not in the cluster can see both a red cell and a green cell, then the cell cannot have
+            // v as a candidate
+            int      other;
+            Bitboard redDependents;
+            Bitboard greenDependents;
+            if (canSeeBoth(v, cluster, other, redDependents, greenDependents))
             {
                 indexes.push_back(other);
                 values.push_back(v);
@@ -81,7 +114,51 @@ bool SimpleColoring::exists(std::vector<int> & indexes, std::vector<int> & value
     return false;
 }
 
-std::string SimpleColoring::generateReason(int v, std::vector<int> const & collisions, std::set<int> const & eliminated)
+std::vector<SimpleColoring::Cluster> SimpleColoring::findClusters(int v) const
+{
+    // Join the two cells of each conjugate pair
+    Clusters clusters;
+    Bitboard cells      = links_.cells(v);
+    unsigned conjugates = links_.conjugates(v);
+    for (int g = 0; g < Positions::NUM_GROUPS; ++g)
+    {
+        if (conjugates & (1u << g))
+        {
+            Bitboard pair = cells & Bitboard::group(g);
+            int      i0   = pair.pop();
+            int      i1   = pair.pop();
+            clusters.join(i0, i1);
+        }
+    }
+
+    // Color the cells of each cluster relative to its lowest cell. Since the cells are visited in increasing order, the clusters are
+    // found in order of their lowest cells.
+    std::vector<Cluster> result;
+    int                  which[Board::NUM_CELLS];       // Index of the cluster with each root
+    int                  rootParity[Board::NUM_CELLS];  // Parity of the lowest cell of the cluster with each root
+    std::fill(std::begin(which), std::end(which), -1);
+    while (!cells.empty())
+    {
+        int i = cells.pop();
+        int parity;
+        int root = clusters.find(i, parity);
+        if (which[root] < 0)
+        {
+            which[root]      = (int)result.size();
+            rootParity[root] = parity;
+            result.emplace_back();
+        }
+
+        Cluster & cluster = result[which[root]];
+        if (parity == rootParity[root])
+            cluster.red.set(i);
+        else
+            cluster.green.set(i);
+    }
+    return result;
+}
+
+std::string SimpleColoring::generateReason(int v, std::vector<int> const & collisions)
 {
     std::string reason = "These squares cannot be ";
     reason += std::to_string(v);
@@ -94,18 +171,13 @@ std::string SimpleColoring::generateReason(int v, std::vector<int> const & colli
     return reason;
 }
 
-std::string SimpleColoring::generateReason(int v, int i, std::vector<int> const & red, std::vector<int> const & green)
+std::string SimpleColoring::generateReason(int v, int i, Bitboard const & red, Bitboard const & green)
 {
-    std::vector<int> combined;
-    combined.insert(combined.end(), red.begin(), red.end());
-    combined.insert(combined.end(), green.begin(), green.end());
-    std::sort(combined.begin(), combined.end());
-
     std::string reason = Board::Cell::name(i) +
                          " cannot be " +
                          std::to_string(v) +
                          " because one of";
-    for (auto i1 : combined)
+    for (auto i1 : (red | green).indexes())
     {
         reason += " " + Board::Cell::name(i1);
     }
@@ -113,95 +185,49 @@ std::string SimpleColoring::generateReason(int v, int i, std::vector<int> const
     return reason;
 }
 
-void SimpleColoring::createGraph(int v, int i0, std::set<int> & a, std::set<int> & b)
-{
-    // From cell i0, recursively build a DAG of strong links between unlinked cells with candidate v.
-    // This cell goes into list 'a'. The ones linked to it go into list 'b'.
-    a.insert(i0);
-    Link::Strong::List links = Link::Strong::find(candidates_, i0);
-    for (auto const & link : links)
-    {
-        // Only care about this value for simple coloring
-        if (link.v0 != v || link.v1 != v)
-            continue;
-
-        // If the other cell hasn't already been included in list 'b', then recursively extend the graph. Note that there is
-        // no possibility of the other cell already being in list 'a'.
-        int other = (i0 == link.i0) ? link.i1 : link.i0;
-        if (b.find(other) == b.end())
-            createGraph(v, other, b, a);  // Note: swapping the lists in order to alternate inferences.
-    }
-}
-
-bool SimpleColoring::collisionsFound(std::set<int> const & indexes, std::vector<int> & collisions)
+bool SimpleColoring::collisionsFound(Bitboard const & color, std::vector<int> & collisions)
 {
-    if (!indexes.empty())
+    // Find the first cell that can see any of the cells after it
+    for (Bitboard remaining = color; !remaining.empty();)
     {
-        auto pBack = std::prev(indexes.end());
-        for (auto pI = indexes.begin(); pI != pBack; ++pI)
+        int      i    = remaining.pop();
+        Bitboard seen = Bitboard::peers(i) & remaining;
+        if (!seen.empty())
         {
-            std::vector<int> const & seen = Board::Cell::dependents(*pI);
-            std::set_intersection(seen.begin(), seen.end(), std::next(pI), indexes.end(), std::back_inserter(collisions));
-            if (!collisions.empty())
-            {
-                collisions.insert(collisions.begin(), *pI);
-                return true;
-            }
+            collisions = seen.indexes();
+            collisions.insert(collisions.begin(), i);
+            return true;
         }
     }
     return false;
 }
 
-bool SimpleColoring::canSeeBoth(int                   v,
-                                std::set<int> const & red,
-                                std::set<int> const & green,
-                                int &                 other,
-                                std::vector<int> &    redDependents,
-                                std::vector<int> &    greenDependents)
+bool SimpleColoring::canSeeBoth(int             v,
+                                Cluster const & cluster,
+                                int &           other,
+                                Bitboard &      redDependents,
+                                Bitboard &      greenDependents) const
 {
-    if (!red.empty() && !green.empty())
+    // Find the cells that can see a red cell and the cells that can see a green cell
+    Bitboard seesRed;
+    for (Bitboard red = cluster.red; !red.empty();)
     {
-        // Get all cells with the candidate not in the chain
-        std::vector<int> others = Candidates::findAll(candidates_, v);
-        {
-            std::vector<int> temp;
-            std::set_difference(others.begin(), others.end(), red.begin(), red.end(), std::back_inserter(temp));
-            others = std::move(temp);
-        }
-        {
-            std::vector<int> temp;
-            std::set_difference(others.begin(), others.end(), green.begin(), green.end(), std::back_inserter(temp));
-            others = std::move(temp);
-        }
-
-        // If any cell not in the chain can see both a red cell and a green cell, then the candidate can be eliminated from that
-        // cell
-        if (!others.empty())
-        {
-            for (auto o : others)
-            {
-                std::vector<int> const & dependents = Board::Cell::dependents(o);
-                std::set_intersection(dependents.begin(),
-                                      dependents.end(),
-                                      red.begin(),
-                                      red.end(),
-                                      std::back_inserter(redDependents));
-                if (redDependents.empty())
-                    continue;
-
-                std::set_intersection(dependents.begin(),
-                                      dependents.end(),
-                                      green.begin(),
-                                      green.end(),
-                                      std::back_inserter(greenDependents));
-                if (!greenDependents.empty())
-                {
-                    other = o;
-                    return true;
-                }
-                redDependents.clear();
-            }
-        }
+        seesRed |= Bitboard::peers(red.pop());
     }
-    return false;
+    Bitboard seesGreen;
+    for (Bitboard green = cluster.green; !green.empty();)
+    {
+        seesGreen |= Bitboard::peers(green.pop());
+    }
+
+    // If any cell with the candidate not in the cluster can see both a red cell and a green cell, then the candidate can be
+    // eliminated from that cell
+    Bitboard others = links_.cells(v) & ~(cluster.red | cluster.green) & seesRed & seesGreen;
+    if (others.empty())
+        return false;
+
+    other           = others.first();
+    redDependents   = Bitboard::peers(other) & cluster.red;
+    greenDependents = Bitboard::peers(other) & cluster.green;
+    return true;
 }
@@ -2,32 +2,36 @@
 #define ANALYZER_SIMPLECOLORING_H_INCLUDED 1
 #pragma once
 
-#include "Candidates.h"
-#include <set>
+#include "Bitboard.h"
+#include "LinkGraph.h"
 #include <string>
 #include <vector>
 
 class SimpleColoring
 {
 public:
-    SimpleColoring(Candidates::List const & candidates) : candidates_(candidates) {}
+    SimpleColoring(LinkGraph const & links) : links_(links) {}
 
     // Returns true if a simple coloring elimination exists
     bool exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason);
 
 private:
-    void createGraph(int v, int i0, std::set<int> & a, std::set<int> & b);
-    bool canSeeBoth(int                   v,
-                    std::set<int> const & red,
-                    std::set<int> const & green,
-                    int &                 other,
-                    std::vector<int> &    redDependents,
-                    std::vector<int> &    greenDependents);
-    static std::string generateReason(int v, std::vector<int> const & collisions, std::set<int> const & eliminated);
-    static std::string generateReason(int v, int i, std::vector<int> const & red, std::vector<int> const & green);
-    static bool        collisionsFound(std::set<int> const & indexes, std::vector<int> & collisions);
-
-    Candidates::List const & candidates_;
+    // A cluster of cells connected by strong links, as the two sets of cells with the same color
+    struct Cluster
+    {
+        Bitboard red;       // The cells with the same color as the lowest cell
+        Bitboard green;     // The other cells
+    };
+
+    // Returns the clusters of cells connected by strong links for value v, in order of their lowest cells
+    std::vector<Cluster> findClusters(int v) const;
+
+    bool canSeeBoth(int v, Cluster const & cluster, int & other, Bitboard & redDependents, Bitboard & greenDependents) const;
+    static std::string generateReason(int v, std::vector<int> const & collisions);
+    static std::string generateReason(int v, int i, Bitboard const & red, Bitboard const & green);
+    static bool        collisionsFound(Bitboard const & color, std::vector<int> & collisions);
+
+    LinkGraph const & links_;
 };
 
 #endif // defined(ANALYZER_SIMPLECOLORING_H_INCLUDED)
@@ -0,0 +1,198 @@
+#include "Subset.h"
+
+#include "Candidates.h"
+#include "Combinations.h"
+#include "Positions.h"
+
+#include "Board/Board.h"
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif // defined(_MSC_VER)
+
+namespace
+{
+// Returns the number of bits set
+int countBits(unsigned bits)
+{
+#if defined(_MSC_VER)
+    return (int)__popcnt(bits);
+#else
+    return __builtin_popcount(bits);
+#endif // defined(_MSC_VER)
+}
+
+// Finds the first combination of N elements whose masks together have exactly N bits, and which shares a bit with at least one
+// other element. Returns the elements and the union of their masks.
+template <int N>
+bool search(unsigned const (&masks)[Board::SIZE], unsigned & elements, unsigned & covered)
+{
+    // Only elements with 2 to N bits can be in a subset. Elements with only 1 bit are singles, and are handled elsewhere.
+    unsigned eligible = 0;
+    for (int k = 0; k < Board::SIZE; ++k)
+    {
+        int n = countBits(masks[k]);
+        if (n >= 2 && n <= N)
+            eligible |= 1u << k;
+    }
+    if (countBits(eligible) < N)
+        return false;
+
+    for (auto const & combination : COMBINATIONS<N>.table)
+    {
+        if ((combination.mask & ~eligible) != 0)
+            continue;
+
+        unsigned u = 0;
+        for (int e : combination.elements)
+        {
+            u |= masks[e];
+        }
+        if (countBits(u) != N)
+            continue;
+
+        // Candidates can be eliminated only if an element outside of the subset shares any of its bits
+        for (int k = 0; k < Board::SIZE; ++k)
+        {
+            if ((combination.mask & (1u << k)) == 0 && (masks[k] & u) != 0)
+            {
+                elements = combination.mask;
+                covered  = u;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Returns the list joined with commas, and the given conjunction before the last item
+std::string join(std::vector<std::string> const & items, char const * conjunction)
+{
+    std::string list = items.front();
+    for (size_t k = 1; k < items.size(); ++k)
+    {
+        list += (k + 1 < items.size()) ? ", " : conjunction;
+        list += items[k];
+    }
+    return list;
+}
+
+char const * const NUMBERS[] = { "zero", "one", "two", "three", "four" };
+char const * const CAPITALIZED_NUMBERS[] = { "Zero", "One", "Two", "Three", "Four" };
+} // anonymous namespace
+
+template <int N, bool HIDDEN>
+bool Subset<N, HIDDEN>::exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason) const
+{
+    // For each row, then each column, then each box, if there is a subset and it eliminates any candidates, then success.
+    std::vector<int> members;
+    for (int g = 0; g < Positions::NUM_GROUPS; ++g)
+    {
+        if (find(g, indexes, values, members))
+        {
+            reason = Subset::reason(g, members);
+            return true;
+        }
+    }
+    return false;
+}
+
+template <int N, bool HIDDEN>
+bool Subset<N, HIDDEN>::find(int                g,
+                             std::vector<int> & eliminatedIndexes,
+                             std::vector<int> & eliminatedValues,
+                             std::vector<int> & members) const
+{
+    std::vector<int> const & group = Positions::indexes(g);
+
+    // The masks of the elements. For a naked subset, they are the candidates of each cell. For a hidden subset, they are the cells
+    // in which each value can be (the transpose), with value v as element v - 1.
+    unsigned masks[Board::SIZE];
+    if (HIDDEN)
+    {
+        std::copy(std::begin(positions_->group(g)), std::end(positions_->group(g)), masks);
+    }
+    else
+    {
+        for (int k = 0; k < Board::SIZE; ++k)
+        {
+            masks[k] = candidates_[group[k]];
+        }
+    }
+
+    unsigned elements;
+    unsigned covered;
+    if (!search<N>(masks, elements, covered))
+        return false;
+
+    eliminatedIndexes.clear();
+    members.clear();
+    if (HIDDEN)
+    {
+        // The cells of the subset cannot have any values other than the subset's values
+        Candidates::Type subsetValues = elements << 1;
+        Candidates::Type others       = Candidates::NONE;
+        for (int k = 0; k < Board::SIZE; ++k)
+        {
+            if (covered & (1u << k))
+            {
+                eliminatedIndexes.push_back(group[k]);
+                others |= candidates_[group[k]];
+            }
+        }
+        eliminatedValues = Candidates::values(others & ~subsetValues);
+        members          = Candidates::values(subsetValues);
+    }
+    else
+    {
+        // The other cells in the group cannot have any of the subset's values
+        for (int k = 0; k < Board::SIZE; ++k)
+        {
+            if (elements & (1u << k))
+                members.push_back(group[k]);
+            else if (candidates_[group[k]] & covered)
+                eliminatedIndexes.push_back(group[k]);
+        }
+        eliminatedValues = Candidates::values(covered);
+    }
+    return true;
+}
+
+template <int N, bool HIDDEN>
+std::string Subset<N, HIDDEN>::reason(int g, std::vector<int> const & members)
+{
+    std::vector<std::string> names;
+    std::string              where = Positions::name(g);
+    if (HIDDEN)
+    {
+        for (int v : members)
+        {
+            names.push_back(std::to_string(v));
+        }
+        return std::string("Only these ") + NUMBERS[N] + " squares in " + where +
+               " can be " + join(names, (N == 2) ? " or " : ", or ") +
+               ", so they cannot be any other values.";
+    }
+    else
+    {
+        for (int i : members)
+        {
+            names.push_back(Board::Cell::name(i));
+        }
+        return std::string(CAPITALIZED_NUMBERS[N]) + " other squares (" + join(names, " and ") + ") in " + where +
+               " must be one of these " + NUMBERS[N] + " values, so these squares cannot be " + ((N == 2) ? "either" : "any") +
+               " of these " + NUMBERS[N] + " values.";
+    }
+}
+
+template class Subset<2, false>;
+template class Subset<3, false>;
+template class Subset<4, false>;
+template class Subset<2, true>;
+template class Subset<3, true>;
+template class Subset<4, true>;
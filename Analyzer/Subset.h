@@ -0,0 +1,53 @@
+#if !defined(ANALYZER_SUBSET_H_INCLUDED)
+#define ANALYZER_SUBSET_H_INCLUDED 1
+#pragma once
+
+#include "Board/Board.h"
+#include "Candidates.h"
+#include "Positions.h"
+
+#include <string>
+#include <vector>
+
+// Finds naked and hidden subsets (pairs, triples and quads) of size N.
+//
+// A group is reduced to 9 masks, one for each element. For a naked subset, the elements are the cells and the masks are their
+// candidates. For a hidden subset, the elements are the values and the masks are the cells (as offsets in the group) in which each
+// value can be. Either way, a subset is N elements whose masks together have exactly N bits, so both are found by the same search
+// over a precomputed table of the combinations of N of the 9 elements.
+template <int N, bool HIDDEN>
+class Subset
+{
+public:
+    static_assert(N >= 2 && N <= 4, "Only pairs, triples and quads are supported");
+
+    // Constructor. The positions of the values in each group are required only for hidden subsets.
+    Subset(Candidates::List const & candidates, Positions const * positions = nullptr)
+        : candidates_(candidates)
+        , positions_(positions)
+    {
+        XCODE_COMPATIBLE_ASSERT(!HIDDEN || positions_);
+    }
+
+    // Returns true if a subset exists in a row, column or box and candidates can be eliminated because of it
+    // Returns the indexes and values to eliminate and a description
+    bool exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason) const;
+
+private:
+    // Finds a subset in group g. Returns the indexes and values to eliminate, and the members of the subset (cells if naked and
+    // values if hidden).
+    bool find(int g, std::vector<int> & eliminatedIndexes, std::vector<int> & eliminatedValues, std::vector<int> & members) const;
+
+    static std::string reason(int g, std::vector<int> const & members);
+
+    Candidates::List const & candidates_;
+    Positions const * positions_;
+};
+
+template <int N>
+using NakedSubset = Subset<N, false>;
+
+template <int N>
+using HiddenSubset = Subset<N, true>;
+
+#endif // defined(ANALYZER_SUBSET_H_INCLUDED)
@@ -1,138 +1,327 @@
 #include "UniqueRectangle.h"
 
+#include "Bitboard.h"
+#include "Combinations.h"
+#include "LinkGraph.h"
+#include "Positions.h"
+
 #include "Board/Board.h"
 #include "Candidates.h"
 
+#include <array>
 #include <string>
-#include <utility>
 #include <vector>
 
-// A Pair is a pair of indexes (in the same row or column)
-using Pair = std::pair<int, int>;
-
-// A Rect is a pair of pairs. The first pair is the floor indexes, and the second is the roof indexes.
-using Rect = std::pair<Pair, Pair>;
+namespace
+{
+// A rectangle whose corners are in exactly two boxes
+struct Rectangle
+{
+    int      corners[4];    // The corners in increasing order
+    Bitboard cells;         // The corners as a set
+};
 
-bool UniqueRectangle::exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason)
+// Returns true if the corners of the rectangle with the given rows and columns are in exactly two boxes. That is the case if its
+// rows are in the same band or its columns are in the same stack, but not both, since a rectangle within one box cannot be a
+// deadly pattern.
+constexpr bool isValid(int r0, int r1, int c0, int c1)
 {
-    // If 4 cells containing the same exclusive pairs are within 2 boxes and form a rectangle, then the solution cannot be unique.
-    // Therefore, any candidates that lead to this condition can be removed.
+    return (r0 / Board::BOX_SIZE == r1 / Board::BOX_SIZE) != (c0 / Board::BOX_SIZE == c1 / Board::BOX_SIZE);
+}
 
-    // Find all exclusive pairs whose cells are in the same box and row or column (the "floors").
-    // Note that types 2B, 2C, 3, 3B, 3/3B w/triples, and 4B are not supported when requiring the floor to be in a single box.
-    std::vector<Pair> floors;
-    Board::ForEach::box([&](int b, std::vector<int> const & box) {
-                            for (int i = 0; i < box.size() - 1; ++i)
-                            {
-                                int b0 = box[i];
-                                if (Candidates::isBivalue(candidates_[b0]))
-                                {
-                                    for (int j = i + 1; j < box.size(); ++j)
-                                    {
-                                        int b1 = box[j];
-
-                                        // If its the same as the other bivalue and it is in the same row or column, then we have a
-                                        // floor.
-                                        if (candidates_[b0] == candidates_[b1])
-                                        {
-                                            int r0, c0, r1, c1;
-                                            Board::Cell::locationOf(b0, &r0, &c0);
-                                            Board::Cell::locationOf(b1, &r1, &c1);
-                                            if (r0 == r1 || c0 == c1)
-                                                floors.push_back(std::make_pair(b0, b1));
-                                        }
-                                    }
-                                }
-                            }
-                            return true;
-                        });
-
-    // Go through the floors and look for roofs.
-    for (auto const & floor : floors)
+// Returns the number of rectangles whose corners are in exactly two boxes
+constexpr int countRectangles()
+{
+    int n = 0;
+    for (int r0 = 0; r0 < Board::SIZE; ++r0)
     {
-        Candidates::Type floorCandidates = candidates_[floor.first];
-
-        int r0, c0, r1, c1;
-        Board::Cell::locationOf(floor.first, &r0, &c0);
-        Board::Cell::locationOf(floor.second, &r1, &c1);
-
-        // If the floor is in a row, look for the roof in the other rows. Otherwise, look in the other columns
-        if (r0 == r1)
+        for (int r1 = r0 + 1; r1 < Board::SIZE; ++r1)
         {
-            for (int r = 0; r < Board::SIZE; ++r)
+            for (int c0 = 0; c0 < Board::SIZE; ++c0)
             {
-                if (r != r0)
+                for (int c1 = c0 + 1; c1 < Board::SIZE; ++c1)
                 {
-                    int roof0 = Board::Cell::indexOf(r, c0);
-                    int roof1 = Board::Cell::indexOf(r, c1);
-                    if (exists(floor.first, floor.second, roof0, roof1, floorCandidates, indexes, values, reason))
-                        return true;
+                    if (isValid(r0, r1, c0, c1))
+                        ++n;
                 }
             }
         }
-        else
+    }
+    return n;
+}
+
+int constexpr NUM_RECTANGLES = countRectangles();
+
+// Returns the rectangles, ordered by their rows and then their columns
+constexpr std::array<Rectangle, NUM_RECTANGLES> makeRectangles()
+{
+    std::array<Rectangle, NUM_RECTANGLES> rectangles{};
+    int n = 0;
+    for (int r0 = 0; r0 < Board::SIZE; ++r0)
+    {
+        for (int r1 = r0 + 1; r1 < Board::SIZE; ++r1)
         {
-            for (int c = 0; c < Board::SIZE; ++c)
+            for (int c0 = 0; c0 < Board::SIZE; ++c0)
             {
-                if (c != c0)
+                for (int c1 = c0 + 1; c1 < Board::SIZE; ++c1)
                 {
-                    int roof0 = Board::Cell::indexOf(r0, c);
-                    int roof1 = Board::Cell::indexOf(r1, c);
-                    if (exists(floor.first, floor.second, roof0, roof1, floorCandidates, indexes, values, reason))
-                        return true;
+                    if (!isValid(r0, r1, c0, c1))
+                        continue;
+
+                    Rectangle & rectangle = rectangles[n++];
+                    rectangle.corners[0] = r0 * Board::SIZE + c0;
+                    rectangle.corners[1] = r0 * Board::SIZE + c1;
+                    rectangle.corners[2] = r1 * Board::SIZE + c0;
+                    rectangle.corners[3] = r1 * Board::SIZE + c1;
+                    for (int i : rectangle.corners)
+                    {
+                        rectangle.cells = rectangle.cells | Bitboard::cell(i);
+                    }
                 }
             }
         }
     }
+    return rectangles;
+}
+
+constexpr std::array<Rectangle, NUM_RECTANGLES> RECTANGLES = makeRectangles();
+
+// Finds N cells (as offsets in a group) that together with a cell having the given candidates form a naked subset, and which
+// eliminate candidates from the other eligible cells. Returns the subset's members and values.
+template <int N>
+bool findSubset(unsigned const (&masks)[Board::SIZE],
+                unsigned           eligible,
+                Candidates::Type   candidates,
+                unsigned &         members,
+                Candidates::Type & values)
+{
+    for (auto const & combination : COMBINATIONS<N>.table)
+    {
+        if ((combination.mask & ~eligible) != 0)
+            continue;
+
+        Candidates::Type u = candidates;
+        for (int e : combination.elements)
+        {
+            u |= masks[e];
+        }
+        if (Candidates::count(u) != N + 1)
+            continue;
+
+        for (int k = 0; k < Board::SIZE; ++k)
+        {
+            if ((eligible & ~combination.mask & (1u << k)) != 0 && (masks[k] & u) != 0)
+            {
+                members = combination.mask;
+                values  = u;
+                return true;
+            }
+        }
+    }
     return false;
 }
 
-bool UniqueRectangle::exists(int                floor0,
-                             int                floor1,
-                             int                roof0,
-                             int                roof1,
-                             Candidates::Type   floorCandidates,
-                             std::vector<int> & indexes,
-                             std::vector<int> & values,
-                             std::string &      reason)
-{
-    bool corner3Matches            = candidates_[roof0] == floorCandidates;
-    bool corner4Matches            = candidates_[roof1] == floorCandidates;
-    bool corner3IncludesPair       = !corner3Matches && (candidates_[roof0] & floorCandidates) == floorCandidates;
-    bool corner4IncludesPair       = !corner4Matches && (candidates_[roof1] & floorCandidates) == floorCandidates;
-    Candidates::Type corner3Others = candidates_[roof0] & ~floorCandidates;
-    Candidates::Type corner4Others = candidates_[roof1] & ~floorCandidates;
-
-    // Type 1: Exactly one of the corners of the roof has other candidates and can only be those
-    // other candidates
-    if (corner3Matches && corner4IncludesPair || corner3IncludesPair && corner4Matches)
+// Returns the list joined with commas, and the given conjunction before the last item
+std::string join(std::vector<std::string> const & items, char const * conjunction)
+{
+    std::string list = items.front();
+    for (size_t k = 1; k < items.size(); ++k)
     {
-        if (corner3IncludesPair)
-            indexes.push_back(roof0);
-        else
-            indexes.push_back(roof1);
-        values = Candidates::values(floorCandidates);
-        reason = generateType1Reason(floor0, floor1, roof0, roof1, indexes[0], values);
-        return true;
+        list += (k + 1 < items.size()) ? ", " : conjunction;
+        list += items[k];
+    }
+    return list;
+}
+
+// Returns the values as a list of numbers
+std::vector<std::string> names(std::vector<int> const & values)
+{
+    std::vector<std::string> names;
+    for (int v : values)
+    {
+        names.push_back(std::to_string(v));
     }
+    return names;
+}
+} // anonymous namespace
 
-    // Type 2: Both corners of the roof have exactly one other candidate and that candidate can
-    // be eliminated from any cells that can see both corners of the roof.
-    else if (corner3IncludesPair &&
-             corner4IncludesPair &&
-             corner3Others == corner4Others &&
-             Candidates::isSolved(corner3Others))
+bool UniqueRectangle::exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason)
+{
+    // If 4 cells containing the same exclusive pairs are within 2 boxes and form a rectangle, then the solution cannot be unique.
+    // Therefore, any candidates that lead to this condition can be removed.
+
+    Bitboard const & bivalues = links_.bivalues();
+    for (auto const & rectangle : RECTANGLES)
     {
-        std::vector<int> dependents = Board::Cell::dependents(roof0, roof1);
-        for (auto d : dependents)
+        // At least two of the corners must be bivalue cells
+        Bitboard floor = bivalues & rectangle.cells;
+        if (floor.count() < 2)
+            continue;
+
+        // Every corner must include the pair of a bivalue corner
+        Candidates::Type pair     = candidates_[floor.first()];
+        bool             included = true;
+        for (int i : rectangle.corners)
+        {
+            if ((candidates_[i] & pair) != pair)
+                included = false;
+        }
+        if (!included)
+            continue;
+
+        // The floor is the corners that are only the pair, and the roof is the rest
+        int floors[4];
+        int roofs[4];
+        int nFloors = 0;
+        int nRoofs  = 0;
+        for (int i : rectangle.corners)
         {
-            if (candidates_[d] & corner3Others)
-                indexes.push_back(d);
+            if (candidates_[i] == pair)
+                floors[nFloors++] = i;
+            else
+                roofs[nRoofs++] = i;
         }
-        if (!indexes.empty())
+
+        // Type 1: Exactly one of the corners has other candidates and can only be those other candidates
+        if (nFloors == 3)
         {
-            values = Candidates::values(corner3Others);
-            reason = generateType2Reason(floor0, floor1, roof0, roof1, indexes, values[0]);
+            indexes.push_back(roofs[0]);
+            values = Candidates::values(pair);
+            reason = generateType1Reason(floors[0], floors[1], floors[2], roofs[0], roofs[0], values);
+            return true;
+        }
+
+        // Types 2, 3 and 4: Two of the corners have other candidates. They can be on the same side, or diagonal.
+        if (nFloors == 2 && roofExists(floors[0], floors[1], roofs[0], roofs[1], pair, indexes, values, reason))
+            return true;
+    }
+    return false;
+}
+
+bool UniqueRectangle::roofExists(int                floor0,
+                                 int                floor1,
+                                 int                roof0,
+                                 int                roof1,
+                                 Candidates::Type   pair,
+                                 std::vector<int> & indexes,
+                                 std::vector<int> & values,
+                                 std::string &      reason)
+{
+    Candidates::Type roof0Others = candidates_[roof0] & ~pair;
+    Candidates::Type roof1Others = candidates_[roof1] & ~pair;
+
+    // Type 2: Both corners of the roof have exactly one other candidate and that candidate can be eliminated from any cells that can
+    // see both corners of the roof.
+    if (roof0Others == roof1Others && Candidates::isSolved(roof0Others))
+    {
+        int      v          = Candidates::value(roof0Others);
+        Bitboard eliminated = links_.cells(v) & Bitboard::peers(roof0) & Bitboard::peers(roof1);
+        if (!eliminated.empty())
+        {
+            indexes = eliminated.indexes();
+            values.push_back(v);
+            reason = generateType2Reason(floor0, floor1, roof0, roof1, indexes, v);
+            return true;
+        }
+    }
+
+    // Types 3 and 4 apply to the groups containing both corners of the roof
+    std::vector<int> groups;
+    int              r0, c0, r1, c1;
+    Board::Cell::locationOf(roof0, &r0, &c0);
+    Board::Cell::locationOf(roof1, &r1, &c1);
+    if (r0 == r1)
+        groups.push_back(Positions::row(r0));
+    if (c0 == c1)
+        groups.push_back(Positions::column(c0));
+    if (Board::Group::whichBox(roof0) == Board::Group::whichBox(roof1))
+        groups.push_back(Positions::box(Board::Group::whichBox(roof0)));
+
+    for (int g : groups)
+    {
+        if (type3Exists(g, floor0, floor1, roof0, roof1, pair, indexes, values, reason))
+            return true;
+    }
+    for (int g : groups)
+    {
+        if (type4Exists(g, floor0, floor1, roof0, roof1, pair, indexes, values, reason))
+            return true;
+    }
+    return false;
+}
+
+bool UniqueRectangle::type3Exists(int                g,
+                                  int                floor0,
+                                  int                floor1,
+                                  int                roof0,
+                                  int                roof1,
+                                  Candidates::Type   pair,
+                                  std::vector<int> & indexes,
+                                  std::vector<int> & values,
+                                  std::string &      reason)
+{
+    // One of the corners of the roof must have one of the other candidates, so the roof acts as a single cell with those candidates.
+    // If it forms a naked subset with other cells in the group, then the subset's values can be eliminated from the rest of the
+    // group.
+    Candidates::Type others = (candidates_[roof0] | candidates_[roof1]) & ~pair;
+    if (Candidates::count(others) < 2)
+        return false;
+
+    std::vector<int> const & group = Positions::indexes(g);
+    unsigned                 masks[Board::SIZE];
+    unsigned                 eligible = 0;
+    for (int k = 0; k < Board::SIZE; ++k)
+    {
+        int i = group[k];
+        masks[k] = candidates_[i];
+        if (i != roof0 && i != roof1 && !Candidates::isSolved(candidates_[i]))
+            eligible |= 1u << k;
+    }
+
+    unsigned         members;
+    Candidates::Type subset;
+    if (!findSubset<1>(masks, eligible, others, members, subset) &&
+        !findSubset<2>(masks, eligible, others, members, subset) &&
+        !findSubset<3>(masks, eligible, others, members, subset))
+    {
+        return false;
+    }
+
+    std::vector<int> cells;
+    for (int k = 0; k < Board::SIZE; ++k)
+    {
+        if ((members & (1u << k)) != 0)
+            cells.push_back(group[k]);
+        else if ((eligible & (1u << k)) != 0 && (masks[k] & subset) != 0)
+            indexes.push_back(group[k]);
+    }
+    values = Candidates::values(subset);
+    reason = generateType3Reason(floor0, floor1, roof0, roof1, g, cells, values);
+    return true;
+}
+
+bool UniqueRectangle::type4Exists(int                g,
+                                  int                floor0,
+                                  int                floor1,
+                                  int                roof0,
+                                  int                roof1,
+                                  Candidates::Type   pair,
+                                  std::vector<int> & indexes,
+                                  std::vector<int> & values,
+                                  std::string &      reason)
+{
+    // If one of the values of the pair can only be in the roof in the group, then one of the corners of the roof must have that
+    // value, and so neither can have the other value.
+    Bitboard roof = Bitboard::cell(roof0) | Bitboard::cell(roof1);
+    for (int v : Candidates::values(pair))
+    {
+        if ((links_.cells(v) & Bitboard::group(g)) == roof)
+        {
+            int other = Candidates::value(pair & ~Candidates::fromValue(v));
+            indexes.push_back(roof0);
+            indexes.push_back(roof1);
+            values.push_back(other);
+            reason = generateType4Reason(floor0, floor1, roof0, roof1, g, v, other);
             return true;
         }
     }
@@ -161,6 +350,7 @@ std::string UniqueRectangle::generateType1Reason(int                      floor0
              " would result in a non-unique solution.";
     return reason;
 }
+
 std::string UniqueRectangle::generateType2Reason(int                      floor0,
                                                  int                      floor1,
                                                  int                      roof0,
@@ -191,3 +381,61 @@ std::string UniqueRectangle::generateType2Reason(int                      floor0
     reason += ".";
     return reason;
 }
+
+std::string UniqueRectangle::generateType3Reason(int                      floor0,
+                                                 int                      floor1,
+                                                 int                      roof0,
+                                                 int                      roof1,
+                                                 int                      g,
+                                                 std::vector<int> const & members,
+                                                 std::vector<int> const & values)
+{
+    std::vector<int> others = Candidates::values((candidates_[roof0] | candidates_[roof1]) & ~candidates_[floor0]);
+    std::vector<std::string> cells;
+    for (int i : members)
+    {
+        cells.push_back(Board::Cell::name(i));
+    }
+
+    std::string where = Positions::name(g);
+    std::string reason;
+    reason = "One of " +
+             Board::Cell::name(roof0) +
+             " or " +
+             Board::Cell::name(roof1) +
+             " must have one of the values " +
+             join(names(others), (others.size() == 2) ? " or " : ", or ") +
+             " because having the same pairs at " +
+             Board::Cell::name(floor0) + " " +
+             Board::Cell::name(floor1) + " " +
+             Board::Cell::name(roof0) + " " +
+             Board::Cell::name(roof1) +
+             " would result in a non-unique solution. So, together with " +
+             join(cells, " and ") +
+             ", they must have the values " +
+             join(names(values), (values.size() == 2) ? " and " : ", and ") +
+             " in " + where + ", and the other squares in " + where + " cannot have these values.";
+    return reason;
+}
+
+std::string UniqueRectangle::generateType4Reason(int floor0, int floor1, int roof0, int roof1, int g, int conjugate, int value)
+{
+    std::string reason;
+    reason = "In " +
+             Positions::name(g) +
+             ", only " +
+             Board::Cell::name(roof0) +
+             " or " +
+             Board::Cell::name(roof1) +
+             " can have the value " +
+             std::to_string(conjugate) +
+             ", and having the same pairs at " +
+             Board::Cell::name(floor0) + " " +
+             Board::Cell::name(floor1) + " " +
+             Board::Cell::name(roof0) + " " +
+             Board::Cell::name(roof1) +
+             " would result in a non-unique solution. So, neither can have the value " +
+             std::to_string(value) +
+             ".";
+    return reason;
+}
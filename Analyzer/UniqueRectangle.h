@@ -1,26 +1,62 @@
+#if !defined(ANALYZER_UNIQUERECTANGLE_H_INCLUDED)
+#define ANALYZER_UNIQUERECTANGLE_H_INCLUDED 1
 #pragma once
 
 #include "Candidates.h"
+#include "LinkGraph.h"
 #include <string>
 #include <vector>
 
+// Finds unique rectangles.
+//
+// If the 4 corners of a rectangle in exactly two boxes could only have the same two values, then the values could be swapped and the
+// solution would not be unique. The rectangles are precomputed, and a rectangle is considered only if at least two of its corners
+// are bivalue cells with the same pair (the floor) and the other corners include the pair (the roof). Types 1, 2 (A, B and C), 3
+// (and 3B) and 4 (and 4B) are supported.
 class UniqueRectangle
 {
 public:
-    UniqueRectangle(Candidates::List const & candidates) : candidates_(candidates) {}
+    UniqueRectangle(Candidates::List const & candidates, LinkGraph const & links)
+        : candidates_(candidates)
+        , links_(links)
+    {
+    }
 
     // Returns true if a unique rectangle pattern exists
     bool exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason);
 
 private:
-    bool exists(int                i1,
-                int                i2,
-                int                i3,
-                int                i4,
-                Candidates::Type   roofCandidates,
-                std::vector<int> & indexes,
-                std::vector<int> & values,
-                std::string &      reason);
+    // Returns true if candidates can be eliminated because of the roof of a rectangle whose floor has only the pair
+    bool roofExists(int                floor0,
+                    int                floor1,
+                    int                roof0,
+                    int                roof1,
+                    Candidates::Type   pair,
+                    std::vector<int> & indexes,
+                    std::vector<int> & values,
+                    std::string &      reason);
+
+    // Type 3: The other candidates of the roof form a naked subset with other cells in group g
+    bool type3Exists(int                g,
+                     int                floor0,
+                     int                floor1,
+                     int                roof0,
+                     int                roof1,
+                     Candidates::Type   pair,
+                     std::vector<int> & indexes,
+                     std::vector<int> & values,
+                     std::string &      reason);
+
+    // Type 4: One of the values of the pair can only be in the roof in group g
+    bool type4Exists(int                g,
+                     int                floor0,
+                     int                floor1,
+                     int                roof0,
+                     int                roof1,
+                     Candidates::Type   pair,
+                     std::vector<int> & indexes,
+                     std::vector<int> & values,
+                     std::string &      reason);
 
     std::string generateType1Reason(int                      floor0,
                                     int                      floor1,
@@ -34,6 +70,17 @@ private:
                                     int                      roof1,
                                     std::vector<int> const & indexes,
                                     int                      value);
+    std::string generateType3Reason(int                      floor0,
+                                    int                      floor1,
+                                    int                      roof0,
+                                    int                      roof1,
+                                    int                      g,
+                                    std::vector<int> const & members,
+                                    std::vector<int> const & values);
+    std::string generateType4Reason(int floor0, int floor1, int roof0, int roof1, int g, int conjugate, int value);
 
     Candidates::List const & candidates_;
+    LinkGraph const & links_;
 };
+
+#endif // defined(ANALYZER_UNIQUERECTANGLE_H_INCLUDED)
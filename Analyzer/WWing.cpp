@@ -0,0 +1,116 @@
+#include "WWing.h"
+
+#include "Bitboard.h"
+#include "LinkGraph.h"
+#include "Positions.h"
+
+#include "Board/Board.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+bool WWing::exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason)
+{
+    // If two cells that cannot see each other have exactly the same two candidates (v,w), and there is a row, column or box in which
+    // v can only be in two cells, one seeing each of them, then one of those two cells must be v, and so one of the two bivalue cells
+    // must be w. So, all cells that can see both bivalue cells cannot have the candidate w.
+
+    for (int v0 = 1; v0 < Board::SIZE; ++v0)
+    {
+        for (int v1 = v0 + 1; v1 <= Board::SIZE; ++v1)
+        {
+            Bitboard const & pairs = links_.bivalues(v0, v1);
+            if (pairs.count() < 2)
+                continue;
+
+            for (Bitboard first = pairs; !first.empty();)
+            {
+                int              i0     = first.pop();
+                Bitboard const & peers0 = Bitboard::peers(i0);
+                for (Bitboard second = first & ~peers0; !second.empty();)
+                {
+                    int              i1     = second.pop();
+                    Bitboard const & peers1 = Bitboard::peers(i1);
+                    for (int v : { v0, v1 })
+                    {
+                        int w = (v == v0) ? v1 : v0;
+
+                        // Something must be eliminated for the w-wing to be useful
+                        Bitboard eliminated = links_.cells(w) & peers0 & peers1;
+                        if (eliminated.empty())
+                            continue;
+
+                        unsigned conjugates = links_.conjugates(v);
+                        for (int g = 0; g < Positions::NUM_GROUPS; ++g)
+                        {
+                            if ((conjugates & (1u << g)) == 0)
+                                continue;
+
+                            Bitboard link  = links_.cells(v) & Bitboard::group(g);
+                            int      link0 = link.pop();
+                            int      link1 = link.pop();
+                            if (!(peers0.test(link0) && peers1.test(link1)))
+                                std::swap(link0, link1);
+                            if (peers0.test(link0) && peers1.test(link1))
+                            {
+                                indexes = eliminated.indexes();
+                                values.push_back(w);
+                                reason = generateReason(i0, i1, link0, link1, g, v, w, indexes);
+                                return true;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return false;
+}
+
+std::string WWing::generateReason(int i0, int i1, int link0, int link1, int g, int v, int w, std::vector<int> const & eliminated)
+{
+    std::string reason;
+    reason = "Squares " +
+             Board::Cell::name(i0) +
+             " and " +
+             Board::Cell::name(i1) +
+             " can only be " +
+             std::to_string(v) +
+             " or " +
+             std::to_string(w) +
+             ", and in " +
+             Positions::name(g) +
+             " only " +
+             Board::Cell::name(link0) +
+             " or " +
+             Board::Cell::name(link1) +
+             " can be " +
+             std::to_string(v) +
+             ". If square " +
+             Board::Cell::name(link0) +
+             " is " +
+             std::to_string(v) +
+             ", then square " +
+             Board::Cell::name(i0) +
+             " must be " +
+             std::to_string(w) +
+             ", or if square " +
+             Board::Cell::name(link1) +
+             " is " +
+             std::to_string(v) +
+             " then square " +
+             Board::Cell::name(i1) +
+             " must be " +
+             std::to_string(w) +
+             ". Either way, ";
+    for (auto e : eliminated)
+    {
+        reason += Board::Cell::name(e);
+        reason += ' ';
+    }
+    reason += "cannot be " +
+              std::to_string(w) +
+              ".";
+    return reason;
+}
@@ -0,0 +1,29 @@
+#if !defined(ANALYZER_WWING_H_INCLUDED)
+#define ANALYZER_WWING_H_INCLUDED 1
+#pragma once
+
+#include "Board/Board.h"
+#include "LinkGraph.h"
+#include <string>
+#include <vector>
+
+// Finds w-wings.
+//
+// A w-wing is two bivalue cells with the same pair that cannot see each other, connected by a conjugate pair of one of their values
+// (each cell of the conjugate pair sees a different one of the bivalue cells). The bivalue cells with each pair are taken from the
+// link graph's index, and the conjugate pairs from its groups.
+class WWing
+{
+public:
+    WWing(LinkGraph const & links) : links_(links) {}
+
+    // Returns true if a w-wing exists
+    bool exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason);
+
+private:
+    static std::string generateReason(int i0, int i1, int link0, int link1, int g, int v, int w, std::vector<int> const & eliminated);
+
+    LinkGraph const & links_;
+};
+
+#endif // defined(ANALYZER_WWING_H_INCLUDED)
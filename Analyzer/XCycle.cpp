@@ -1,5 +1,10 @@
 #include "XCycle.h"
 
+#include "Bitboard.h"
+#include "Candidates.h"
+#include "Link.h"
+#include "LinkGraph.h"
+
 #include "Board/Board.h"
 
 #include <algorithm>
@@ -23,15 +28,32 @@ bool XCycle::exists(std::vector<int> & indexes, std::vector<int> & values, std::
         // Save the value
         value_ = v;
 
+        // Find the weak links for the value once, since they are followed from many chains
+        withValue_ = Bitboard();
+        for (int i = 0; i < Board::NUM_CELLS; ++i)
+        {
+            if (Candidates::includes(candidates_[i], v))
+                withValue_.set(i);
+        }
+        Bitboard cells = links_.cells(v);
+        for (Bitboard c = cells; !c.empty();)
+        {
+            int i = c.pop();
+            weak_[i] = links_.weak(i, v);
+        }
+
         // Find any x-cycles for the value
-        for (int r = 0; r < Board::NUM_CELLS; ++r)
+        while (!cells.empty())
         {
-            if (Candidates::isSolved(candidates_[r]) || !Candidates::includes(candidates_[r], v))
-                continue;
+            int r = cells.pop();
 
             // Save the root index
             root_ = r;
 
+            // Skip the root if no chain from it can be useful
+            if (!canSucceed())
+                continue;
+
             // The first link is a strong link. If a useful x-cycle was found, return the success
             if (extendStrong(r))
             {
@@ -50,21 +72,16 @@ bool XCycle::extendAny(int from)
 {
     // Extend weak links
     {
-        // Find all weak links at this index
-        Link::Weak::List links = Link::Weak::find(candidates_, from, value_);
-
-        // Remove any links to cells that we have already visited
-        links.erase(std::remove_if(links.begin(), links.end(), [from, this](Link::Weak const & a) {
-                                       int linkEnd = (a.i0 == from) ? a.i1 : a.i0;
-                                       return std::find(chain_.begin(), chain_.end(), linkEnd) != chain_.end();
-                                   }),
-                    links.end());
+        // Find all weak links at this index to cells that we have not already visited
+        Bitboard links = weak_[from] & ~visited_;
 
         // For each weak link, check for the completion of a cycle and if not then try to extend the graph with a strong link
-        for (auto const & link : links)
+        while (!links.empty())
         {
+            int        newEnd = links.pop();
+            Link::Weak link{ value_, from, newEnd };
+            link.normalize();
             weakLinks_.push_back(link);
-            int newEnd = (from == link.i0) ? link.i1 : link.i0;
 
             // If the end of this link is the root cell, then we have a cycle.
             if (newEnd == root_)
@@ -104,12 +121,14 @@ bool XCycle::extendAny(int from)
             {
                 // Add this index to the list of visited indexes in order to avoid loops
                 chain_.push_back(newEnd);
+                visited_.set(newEnd);
 
                 if (extendStrong(newEnd))
                     return true;
 
                 // This index is no longer part of the chain so remove it from the list of visited indexes
                 chain_.pop_back();
+                visited_.reset(newEnd);
             }
 
             // Remove this weak link from the list since it is no longer in the chain
@@ -119,20 +138,13 @@ bool XCycle::extendAny(int from)
 
     // Extend strong links
     {
-        // Find all strong links at this index
-        Link::Strong::List links = Link::Strong::find(candidates_, from, value_);
-
-        // Remove any links to cells that we have already visited
-        links.erase(std::remove_if(links.begin(), links.end(), [from, this](Link::Strong const & a) {
-                                       int linkEnd = (a.i0 == from) ? a.i1 : a.i0;
-                                       return std::find(chain_.begin(), chain_.end(), linkEnd) != chain_.end();
-                                   }),
-                    links.end());
+        // Find all strong links at this index to cells that we have not already visited
+        Bitboard links = links_.strong(from, value_) & ~visited_;
 
         // For each strong link, check for the completion of a cycle and if not then try to extend the graph with a strong link
-        for (auto const & link : links)
+        while (!links.empty())
         {
-            int newEnd = (from == link.i0) ? link.i1 : link.i0;
+            int newEnd = links.pop();
 
             // If the end of this link is the root cell, then we have a cycle.
             if (newEnd == root_)
@@ -172,12 +184,14 @@ bool XCycle::extendAny(int from)
             {
                 // Add this index to the list of visited indexes in order to avoid loops
                 chain_.push_back(newEnd);
+                visited_.set(newEnd);
 
                 if (extendStrong(newEnd))
                     return true;
 
                 // This index is no longer part of the chain so remove it from the list of visited indexes
                 chain_.pop_back();
+                visited_.reset(newEnd);
             }
         }
     }
@@ -189,20 +203,13 @@ bool XCycle::extendAny(int from)
 // Recursively form a graph of alternating weak and strong links by extending each strong link from end
 bool XCycle::extendStrong(int from)
 {
-    // Find all strong links at this index
-    Link::Strong::List links = Link::Strong::find(candidates_, from, value_);
-
-    // Remove any links to cells that we have already visited
-    links.erase(std::remove_if(links.begin(), links.end(), [from, this](Link::Strong const & a) {
-                                   int linkEnd = (a.i0 == from) ? a.i1 : a.i0;
-                                   return std::find(chain_.begin(), chain_.end(), linkEnd) != chain_.end();
-                               }),
-                links.end());
+    // Find all strong links at this index to cells that we have not already visited
+    Bitboard links = links_.strong(from, value_) & ~visited_;
 
     // For each strong link, check for any hits and if not then try to extend the graph with a weak link
-    for (auto const & link : links)
+    while (!links.empty())
     {
-        int newEnd = (from == link.i0) ? link.i1 : link.i0;
+        int newEnd = links.pop();
 
         // If end of this link is the root, then the root must have the candidate value.
         if (newEnd == root_)
@@ -217,12 +224,14 @@ bool XCycle::extendStrong(int from)
         {
             // Add this index to the list of visited indexes in order to avoid loops
             chain_.push_back(newEnd);
+            visited_.set(newEnd);
 
             // Extend the chain with any links from this end.
             bool solved = extendAny(newEnd);
 
             // This index is no longer part of the chain so remove it from the list of visited indexes
             chain_.pop_back();
+            visited_.reset(newEnd);
 
             // If a cycle is found, then return
             if (solved)
@@ -254,6 +263,50 @@ bool XCycle::extendStrong(int from)
     return false;
 }
 
+bool XCycle::canSucceed() const
+{
+    // Cells reached by a strong link, and cells reached by any link from them. The root is never extended.
+    Bitboard root       = Bitboard::cell(root_);
+    Bitboard strongEnds = links_.strong(root_, value_);
+    Bitboard anyEnds;
+    Bitboard frontier   = strongEnds;
+    bool     productive = false;    // True if a weak link that was followed has a cell with the value that can see both ends
+    while (!frontier.empty())
+    {
+        // Follow any link from the cells reached by a strong link. If any cell with the value can see both the root and one of
+        // them, then it is an elimination.
+        Bitboard next;
+        while (!frontier.empty())
+        {
+            int from = frontier.pop();
+            if (canSeeBoth(root_, from))
+                return true;
+
+            for (Bitboard w = weak_[from]; !productive && !w.empty();)
+            {
+                productive = canSeeBoth(from, w.pop());
+            }
+            next |= weak_[from] | links_.strong(from, value_);
+        }
+        next    &= ~(anyEnds | root);
+        anyEnds |= next;
+
+        // Follow a strong link from the cells reached by any link. A strong link back to the root is a solution.
+        while (!next.empty())
+        {
+            Bitboard const & strong = links_.strong(next.pop(), value_);
+            if (strong.test(root_))
+                return true;
+            frontier |= strong;
+        }
+        frontier   &= ~(strongEnds | root);
+        strongEnds |= frontier;
+    }
+
+    // Otherwise, only a cycle through a weak link with an elimination can succeed
+    return productive && !(strongEnds & (weak_[root_] | links_.strong(root_, value_))).empty();
+}
+
 std::string XCycle::generateReason1(std::vector<Reason1Dependency> const & dependencies)
 {
     std::string reason;
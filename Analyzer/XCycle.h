@@ -1,8 +1,10 @@
 #pragma once
 
+#include "Bitboard.h"
 #include "Board/Board.h"
 #include "Candidates.h"
 #include "Link.h"
+#include "LinkGraph.h"
 #include <set>
 #include <string>
 #include <vector>
@@ -10,8 +12,9 @@
 class XCycle
 {
 public:
-    XCycle(Candidates::List const & candidates)
+    XCycle(Candidates::List const & candidates, LinkGraph const & links)
         : candidates_(candidates)
+        , links_(links)
         , value_(0)
         , root_(0)
         , solves_(false)
@@ -36,18 +39,33 @@ private:
     // Recursively form a graph of alternating strong and any links by extending each link from the given index
     bool extendAny(int from);
 
+    // Returns false if no chain from the root can lead to an elimination or a solution. The chains are followed breadth-first by
+    // cell and by whether the cell was reached by a strong link, ignoring whether a chain crosses itself, so each cell is reached at
+    // most twice. Since every chain the depth-first search can form is among them, the search can skip the root if this fails.
+    bool canSucceed() const;
+
+    // Returns true if any cell with the value can see both cells
+    bool canSeeBoth(int i0, int i1) const
+    {
+        return !(withValue_ & Bitboard::peers(i0) & Bitboard::peers(i1)).empty();
+    }
+
     std::string generateReason1(std::vector<Reason1Dependency> const & dependencies);
     std::string generateReason2(int second, int last);
     std::string generateReason3(int last);
 
     Candidates::List const & candidates_;
+    LinkGraph const & links_;
 
     // Search context
     int value_;                     // The current value being analyzed
     int root_;                      // The current root index
     int solves_;                    // True if the found cycle solves a cell (rather than eliminating candidates)
+    Bitboard withValue_;            // Cells with the current value as a candidate
+    Bitboard weak_[Board::NUM_CELLS]; // Weak links of each cell for the current value
     Link::Weak::List weakLinks_;    // All the weak links in the chain
     std::vector<int> chain_;        // Indexes in the chain (excluding the root index)
+    Bitboard visited_;              // Indexes in the chain, as a set
 
     // Solution values
     std::vector<int> indexes_;
@@ -1,12 +1,11 @@
 #include "XYWing.h"
 
+#include "Bitboard.h"
 #include "Candidates.h"
-#include "Link.h"
+#include "LinkGraph.h"
 
 #include "Board/Board.h"
 
-#include <algorithm>
-#include <cassert>
 #include <string>
 #include <vector>
 
@@ -15,78 +14,44 @@ bool XYWing::exists(std::vector<int> & indexes, std::vector<int> & values, std::
     // If a cell has exactly two candidates (v1,v2), and can see one cell with exactly two candidates (v1,v3) and another cell with
     // exactly two candidates (v2,v3), then all cells that can see both of those two cells cannot have the candidate v3.
 
-    std::vector<int> pivots;
-    std::vector<int> pivotValues;
-
-    bool found = !Board::ForEach::cell([&] (int i) {
-                                           return existsAt(i, pivots, pivotValues, indexes, values, reason);
-                                       });
-
-    if (found)
-        reason = generateReason(pivots, pivotValues, indexes);
-    return found;
-}
-
-bool XYWing::existsAt(int                i0,
-                      std::vector<int> & pivots,
-                      std::vector<int> & pivotValues,
-                      std::vector<int> & indexes,
-                      std::vector<int> & values,
-                      std::string &      reason)
-{
-    // Candidates::Type candidates0 = candidates_[i0];
-
-    if (!Candidates::isBivalue(candidates_[i0]))
-        return true;
-
-    Link::Weak::List links = Link::Weak::find(candidates_, i0);
-
-    // Remove all links to cells that do not have exactly two candidates
-    links.erase(std::remove_if(links.begin(), links.end(), [&](Link::Weak const & link) {
-                                   return !Candidates::isBivalue(candidates_[link.i1]);
-                               }), links.end());
-
-    if (links.empty())
-        return true;
-
-    for (auto link1 = links.begin(); link1 != std::prev(links.end()); ++link1)
+    for (Bitboard pivots = links_.bivalues(); !pivots.empty();)
     {
-        int i1 = link1->i1;
-        int v1 = link1->v;
-        Candidates::Type candidates1 = candidates_[i1];
-
-        for (auto link2 = std::next(link1); link2 != links.end(); ++link2)
+        int              i0    = pivots.pop();
+        std::vector<int> pair  = Candidates::values(candidates_[i0]);
+        int              v1    = pair[0];
+        int              v2    = pair[1];
+        Bitboard const & peers = Bitboard::peers(i0);
+        for (int v3 = 1; v3 <= Board::SIZE; ++v3)
         {
-            int i2 = link2->i1;
-            int v2 = link2->v;
-            if (i1 == i2 || v1 == v2)
+            if (v3 == v1 || v3 == v2)
                 continue;
 
-            Candidates::Type candidates2 = candidates_[i2];
-            Candidates::Type candidates3 = (candidates1 & ~Candidates::fromValue(v1)) &
-                                           (candidates2 & ~Candidates::fromValue(v2));
-            if (candidates3)
+            Bitboard wings1 = peers & links_.bivalues(v1, v3);
+            Bitboard wings2 = peers & links_.bivalues(v2, v3);
+            if (wings1.empty() || wings2.empty())
+                continue;
+
+            while (!wings1.empty())
             {
-                assert(Candidates::count(candidates3) == 1);
-                // A XY-wing has been found. The candidate v3 can be removed from all cells that can see both i1 and i2.
-                int v3 = Candidates::value(candidates3);
-                std::vector<int> seen = Board::Cell::dependents(i1, i2);
-                for (auto s : seen)
-                {
-                    if (candidates_[s] & candidates3)
-                        indexes.push_back(s);
-                }
-                if (!indexes.empty())
+                int i1 = wings1.pop();
+                for (Bitboard w = wings2; !w.empty();)
                 {
-                    values.push_back(v3);
-                    pivots      = { i0, i1, i2 };
-                    pivotValues = { v1, v2, v3 };
-                    return false;
+                    int i2 = w.pop();
+
+                    // A xy-wing has been found. The candidate v3 can be removed from all cells that can see both i1 and i2.
+                    Bitboard eliminated = links_.cells(v3) & Bitboard::peers(i1) & Bitboard::peers(i2);
+                    if (!eliminated.empty())
+                    {
+                        indexes = eliminated.indexes();
+                        values.push_back(v3);
+                        reason = generateReason({ i0, i1, i2 }, { v1, v2, v3 }, indexes);
+                        return true;
+                    }
                 }
             }
         }
     }
-    return true;
+    return false;
 }
 
 std::string XYWing::generateReason(std::vector<int> const & pivots,
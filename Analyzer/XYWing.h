@@ -4,30 +4,33 @@
 
 #include "Board/Board.h"
 #include "Candidates.h"
+#include "LinkGraph.h"
 #include <string>
 #include <vector>
 
+// Finds xy-wings.
+//
+// The pivot is a bivalue cell, and its wings are the bivalue cells it can see that share one of its values and a third value. The
+// wings are found with the link graph's index of bivalue cells by pair, intersected with the pivot's peers.
 class XYWing
 {
 public:
-    XYWing(Candidates::List const & candidates) : candidates_(candidates) {}
+    XYWing(Candidates::List const & candidates, LinkGraph const & links)
+        : candidates_(candidates)
+        , links_(links)
+    {
+    }
 
     // Returns true if a xy-wing exists
     bool exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason);
 
 private:
-    bool XYWing::existsAt(int                i0,
-                          std::vector<int> & pivots,
-                          std::vector<int> & pivotValues,
-                          std::vector<int> & indexes,
-                          std::vector<int> & values,
-                          std::string &      reason);
-
     static std::string generateReason(std::vector<int> const & pivots,
                                       std::vector<int> const & values,
                                       std::vector<int> const & eliminated);
 
     Candidates::List const & candidates_;
+    LinkGraph const & links_;
 };
 
 #endif // defined(ANALYZER_XYWING_H_INCLUDED)
@@ -0,0 +1,95 @@
+#include "XYZWing.h"
+
+#include "Bitboard.h"
+#include "Candidates.h"
+#include "LinkGraph.h"
+
+#include "Board/Board.h"
+
+#include <string>
+#include <vector>
+
+bool XYZWing::exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason)
+{
+    // If a cell has exactly three candidates (v1,v2,v3), and can see one cell with exactly two candidates (v1,v3) and another cell
+    // with exactly two candidates (v2,v3), then all cells that can see all three of those cells cannot have the candidate v3.
+
+    for (int i0 = 0; i0 < Board::NUM_CELLS; ++i0)
+    {
+        if (!Candidates::isTrivalue(candidates_[i0]))
+            continue;
+
+        std::vector<int> triple = Candidates::values(candidates_[i0]);
+        Bitboard const & peers  = Bitboard::peers(i0);
+        for (int k = 0; k < 3; ++k)
+        {
+            int v3 = triple[k];
+            int v1 = triple[(k + 1) % 3];
+            int v2 = triple[(k + 2) % 3];
+
+            Bitboard wings1 = peers & links_.bivalues(v1, v3);
+            Bitboard wings2 = peers & links_.bivalues(v2, v3);
+            if (wings1.empty() || wings2.empty())
+                continue;
+
+            // The cells that could have v3 must be able to see the pivot as well as both wings
+            Bitboard seen = links_.cells(v3) & peers;
+            while (!wings1.empty())
+            {
+                int i1 = wings1.pop();
+                for (Bitboard w = wings2; !w.empty();)
+                {
+                    int i2 = w.pop();
+
+                    // A xyz-wing has been found. The candidate v3 can be removed from all cells that can see i0, i1 and i2.
+                    Bitboard eliminated = seen & Bitboard::peers(i1) & Bitboard::peers(i2);
+                    if (!eliminated.empty())
+                    {
+                        indexes = eliminated.indexes();
+                        values.push_back(v3);
+                        reason = generateReason({ i0, i1, i2 }, { v1, v2, v3 }, indexes);
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+    return false;
+}
+
+std::string XYZWing::generateReason(std::vector<int> const & pivots,
+                                    std::vector<int> const & values,
+                                    std::vector<int> const & eliminated)
+{
+    std::string reason;
+    reason = "If square " +
+             Board::Cell::name(pivots[0]) +
+             " is " +
+             std::to_string(values[0]) +
+             ", then square " +
+             Board::Cell::name(pivots[1]) +
+             " must be " +
+             std::to_string(values[2]) +
+             ", or if square " +
+             Board::Cell::name(pivots[0]) +
+             " is " +
+             std::to_string(values[1]) +
+             " then square " +
+             Board::Cell::name(pivots[2]) +
+             " must be " +
+             std::to_string(values[2]) +
+             ", or else square " +
+             Board::Cell::name(pivots[0]) +
+             " is " +
+             std::to_string(values[2]) +
+             ". Either way, ";
+    for (auto e : eliminated)
+    {
+        reason += Board::Cell::name(e);
+        reason += ' ';
+    }
+    reason += "cannot be " +
+              std::to_string(values[2]) +
+              ".";
+    return reason;
+}
@@ -0,0 +1,36 @@
+#if !defined(ANALYZER_XYZWING_H_INCLUDED)
+#define ANALYZER_XYZWING_H_INCLUDED 1
+#pragma once
+
+#include "Board/Board.h"
+#include "Candidates.h"
+#include "LinkGraph.h"
+#include <string>
+#include <vector>
+
+// Finds xyz-wings.
+//
+// The pivot is a cell with exactly three candidates, and its wings are two bivalue cells it can see, each with the third value and
+// a different one of the pivot's other values. Like the xy-wing, the wings are found with the link graph's index of bivalue cells.
+class XYZWing
+{
+public:
+    XYZWing(Candidates::List const & candidates, LinkGraph const & links)
+        : candidates_(candidates)
+        , links_(links)
+    {
+    }
+
+    // Returns true if a xyz-wing exists
+    bool exists(std::vector<int> & indexes, std::vector<int> & values, std::string & reason);
+
+private:
+    static std::string generateReason(std::vector<int> const & pivots,
+                                      std::vector<int> const & values,
+                                      std::vector<int> const & eliminated);
+
+    Candidates::List const & candidates_;
+    LinkGraph const & links_;
+};
+
+#endif // defined(ANALYZER_XYZWING_H_INCLUDED)
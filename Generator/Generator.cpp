@@ -1,12 +1,27 @@
 #include "Generator.h"
 
+#include "Grid.h"
+#include "Transform.h"
+
 #include "Analyzer/Analyzer.h"
 #include "Board/Board.h"
 #include "Solver/Solver.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <mutex>
 #include <numeric>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #if !defined(XCODE_COMPATIBLE_ASSERT)
@@ -17,95 +32,875 @@
 #endif
 #endif // !defined(XCODE_COMPATIBLE_ASSERT)
 
+// Results shared by the boards carved from the same solution
+struct Generator::Cache
+{
+    explicit Cache(Board const & solution) : solution(solution) {}
+
+    Grid                               solution;        // The solution
+    std::vector<Pattern>               unique;          // Sets of clues with a unique solution
+    std::vector<Pattern>               unavoidable;     // Sets of cells where another solution differs from the solution
+    std::unordered_map<Pattern, float> difficulties;    // Difficulties of sets of clues
+};
+
+static_assert(Analyzer::Step::NUMBER_OF_TECHNIQUES <= sizeof(Generator::TechniqueSet) * 8,
+              "Generator::TechniqueSet is too small to hold every technique");
+
+namespace
+{
+float constexpr STUCK_DIFFICULTY = 9001.0f;     // Difficulty of a board that the Analyzer cannot solve
+
+// Parameters for Generator::search()
+float constexpr INITIAL_TEMPERATURE = 1.0f;     // Starting temperature, in units of difficulty
+float constexpr COOLING_RATE        = 0.98f;    // The temperature is multiplied by this after each move
+float constexpr MIN_TEMPERATURE     = 0.01f;    // The temperature never goes below this
+int constexpr   RESTART_THRESHOLD   = 200;      // Number of moves without improvement before starting over with a new solution
+int constexpr   CLUES_REMOVED       = 2;        // Number of clues removed when a move is meant to make the puzzle harder
+
+// Parameters for Generator::generateWithTechniques()
+int constexpr STEERING_SAMPLES = 4;             // Number of candidate removals compared at each step
+int constexpr ABANDON_STEPS    = 3;             // Number of steps that lack a required technique seen earlier before giving up
+
+// Parameters for Generator::generateFromSolution()
+int constexpr ATTEMPTS_PER_BOARD = 10;          // Number of removal orders tried for each board requested
+
+// Parameters for Generator::searchMinimal()
+int constexpr BRANCHING_CLUES = 34;             // Clues are removed in random order down to this number before branching
+int constexpr NODES_PER_BOARD = 500;            // Number of removal orders examined before starting over with a new solution
+
+// Parameters for Generator::generateWithPattern()
+int constexpr NODES_PER_PATTERN_ATTEMPT = 10000; // Number of assignments tried before starting over
+
+// Counts of the work done (see Generator::Stats)
+struct Counters
+{
+    std::atomic<uint64_t> solvedBoards{ 0 };
+    std::atomic<uint64_t> removals{ 0 };
+    std::atomic<uint64_t> notUnique{ 0 };
+    std::atomic<uint64_t> tooDifficult{ 0 };
+    std::atomic<uint64_t> tooEasy{ 0 };
+    std::atomic<uint64_t> uniquenessSearches{ 0 };
+    std::atomic<uint64_t> uniquenessSkipped{ 0 };
+    std::atomic<uint64_t> uniquenessCached{ 0 };
+    std::atomic<uint64_t> uniquenessTime{ 0 };      // In nanoseconds
+    std::atomic<uint64_t> difficultyTime{ 0 };      // In nanoseconds
+} counters;
+
+// Adds the time between its construction and destruction to a total, in nanoseconds
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(std::atomic<uint64_t> & total)
+        : total_(total)
+        , start_(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~ScopedTimer()
+    {
+        total_ += (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_).count();
+    }
+
+private:
+    std::atomic<uint64_t> &               total_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+// Returns the set of cells that have clues
+Generator::Pattern cluesOf(Board const & board)
+{
+    Generator::Pattern clues;
+    for (int i = 0; i < Board::NUM_CELLS; ++i)
+    {
+        clues[i] = !board.isEmpty(i);
+    }
+    return clues;
+}
+
+// Returns the number of bits set
+int countBits(uint32_t bits)
+{
+    int count = 0;
+    for (; bits != 0; bits &= bits - 1)
+    {
+        ++count;
+    }
+    return count;
+}
+
+// Returns the number of clues on the board
+int countClues(Board const & board)
+{
+    int count = 0;
+    for (int i = 0; i < Board::NUM_CELLS; ++i)
+    {
+        if (!board.isEmpty(i))
+            ++count;
+    }
+    return count;
+}
+
+// Calls f(i) for each i in [0, n), spread across all cores
+template <typename F>
+void parallelFor(int n, F f)
+{
+    int              threads = std::min(n, std::max(1, (int)std::thread::hardware_concurrency()));
+    std::atomic<int> next(0);
+    auto             work = [&next, n, &f] () {
+        for (int i = next++; i < n; i = next++)
+        {
+            f(i);
+        }
+    };
+
+    std::vector<std::thread> helpers;
+    for (int t = 1; t < threads; ++t)
+    {
+        helpers.emplace_back(work);
+    }
+    work();
+    for (auto & t : helpers)
+    {
+        t.join();
+    }
+}
+
+// Returns how far the difficulty is outside of the range [minDifficulty, maxDifficulty], or 0 if it is within the range
+float distanceFromRange(float difficulty, float minDifficulty, float maxDifficulty)
+{
+    if (difficulty < minDifficulty)
+        return minDifficulty - difficulty;
+    if (difficulty > maxDifficulty)
+        return difficulty - maxDifficulty;
+    return 0.0f;
+}
+} // anonymous namespace
+
 Board Generator::generate(float maxDifficulty /* = 0.0f*/, float minDifficulty /* = 0.0f*/)
 {
-    float difficulty = 0.0f;
+    float difficulty;
     Board board;
 
     // Generate a random solved boards until we find one with the right difficulty
     do
     {
-        board = generateSolvedBoard();
+        board = carve(generateSolvedBoard(), maxDifficulty, &difficulty);
+        if (difficulty < minDifficulty)
+            ++counters.tooEasy;
+    } while (difficulty < minDifficulty);
+
+    return board;
+}
+
+std::vector<Board> Generator::generateFromSolution(Board const & solution,
+                                                   int           count,
+                                                   float         maxDifficulty /* = 0.0f*/,
+                                                   float         minDifficulty /* = 0.0f*/)
+{
+    Cache                       cache(solution);
+    std::vector<Board>          boards;
+    std::unordered_set<Pattern> seen;
+    for (int attempts = 0; (int)boards.size() < count && attempts < count * ATTEMPTS_PER_BOARD; ++attempts)
+    {
+        float difficulty;
+        Board board = carve(solution, maxDifficulty, &difficulty, &cache);
+        if (difficulty < minDifficulty)
+            ++counters.tooEasy;
+        else if (seen.insert(cluesOf(board)).second)
+            boards.push_back(board);
+    }
+    return boards;
+}
+
+Board Generator::generateMinimal(float maxDifficulty /* = 0.0f*/, float minDifficulty /* = 0.0f*/)
+{
+    Board board;
+    float difficulty;
+    do
+    {
+        board = generate(maxDifficulty, minDifficulty);
+
+        // generate() keeps clues whose removal would make the board too difficult, so remove any that remain one at a time
+        for (std::vector<int> redundant = redundantClues(board); !redundant.empty(); redundant = redundantClues(board))
+        {
+            std::uniform_int_distribution<size_t> pick(0, redundant.size() - 1);
+            board.set(redundant[pick(rng())], Board::EMPTY);
+        }
+        difficulty = computeDifficulty(board);
+    } while ((maxDifficulty > 0.0f && difficulty >= maxDifficulty + 1.0f) || difficulty < minDifficulty);
+
+    return board;
+}
+
+namespace
+{
+// A depth-first branch-and-bound search over the orders in which clues are removed from a board. Each set of removed clues is
+// visited once: after a clue has been tried at a node, it is kept in the boards searched by the node's later children. Since removing
+// a clue never makes a non-unique solution unique again, at most the clues that are currently redundant and not kept can still be
+// removed, so a node is pruned if that cannot lead to fewer clues than the best board found so far.
+class MinimalSearch
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    MinimalSearch(int maxClues, Clock::time_point deadline, std::mt19937 & rng)
+        : maxClues_(maxClues)
+        , deadline_(deadline)
+        , rng_(rng)
+    {
+    }
+
+    // Searches the boards reachable from the given board, which must have a unique solution, until the node limit is reached
+    void run(Board board, int nodeLimit)
+    {
+        bool kept[Board::NUM_CELLS] = {};
+        nodesLeft_ = nodeLimit;
+        branch(board, countClues(board), kept);
+    }
+
+    // Returns true if a good enough board has been found or time has run out
+    bool done() const { return bestClues_ <= maxClues_ || Clock::now() >= deadline_; }
+
+    Board const & best() const { return best_; }
+    int           bestClues() const { return bestClues_; }
+
+private:
+    void branch(Board & board, int clues, bool * kept)
+    {
+        if (nodesLeft_ <= 0 || done())
+            return;
+        --nodesLeft_;
 
-        // Randomly remove as many cells as possible
-        std::vector<int> indexes = randomizedIndexes();
-        for (auto i : indexes)
+        std::vector<int> redundant = Generator::redundantClues(board);
+        if (redundant.empty())
+        {
+            if (clues < bestClues_)
+            {
+                best_      = board;
+                bestClues_ = clues;
+            }
+            return;
+        }
+
+        std::vector<int> removable;
+        std::copy_if(redundant.begin(), redundant.end(), std::back_inserter(removable), [kept] (int i) { return !kept[i]; });
+        if (clues - (int)removable.size() >= bestClues_)
+            return;
+
+        std::shuffle(removable.begin(), removable.end(), rng_);
+        for (int i : removable)
         {
-            // Remove a cell
             int x = board.get(i);
             board.set(i, Board::EMPTY);
+            branch(board, clues - 1, kept);
+            board.set(i, x);
+            kept[i] = true;
+        }
+        for (int i : removable)
+        {
+            kept[i] = false;
+        }
+    }
+
+    int               maxClues_;
+    Clock::time_point deadline_;
+    std::mt19937 &    rng_;
+    int               nodesLeft_ = 0;
+    Board             best_;
+    int               bestClues_ = std::numeric_limits<int>::max();
+};
+} // anonymous namespace
+
+bool Generator::searchMinimal(int maxClues, std::chrono::milliseconds timeLimit, Board & board)
+{
+    MinimalSearch search(maxClues, MinimalSearch::Clock::now() + timeLimit, rng());
+    do
+    {
+        // Remove clues at random down to the branching point, and then search the removal orders from there
+        Board start = generateSolvedBoard();
+        reduce(start, randomizedIndexes(), Board::NUM_CELLS - BRANCHING_CLUES);
+        search.run(start, NODES_PER_BOARD);
+    } while (!search.done());
+
+    // If the time ran out before any minimal board was found, then there is nothing to return
+    if (search.bestClues() == std::numeric_limits<int>::max())
+        return false;
+
+    board = search.best();
+    return search.bestClues() <= maxClues;
+}
+
+std::vector<int> Generator::redundantClues(Board const & board)
+{
+    std::vector<int> clues;
+    for (int i = 0; i < Board::NUM_CELLS; ++i)
+    {
+        if (!board.isEmpty(i))
+            clues.push_back(i);
+    }
 
-            // If the new puzzle doesn't have a unique solution, then undo and try again
-            if (!Solver::hasUniqueSolution(board))
+    std::vector<char> redundant(clues.size(), false);
+    parallelFor((int)clues.size(), [&board, &clues, &redundant] (int k) {
+        Board reduced = board;
+        reduced.set(clues[k], Board::EMPTY);
+        redundant[k] = remainsUnique(reduced, clues[k]);
+    });
+
+    std::vector<int> result;
+    for (size_t k = 0; k < clues.size(); ++k)
+    {
+        if (redundant[k])
+            result.push_back(clues[k]);
+    }
+    return result;
+}
+
+bool Generator::search(float                     maxDifficulty,
+                       float                     minDifficulty,
+                       std::chrono::milliseconds timeLimit,
+                       Board &                   board,
+                       float *                   difficulty /* = nullptr*/)
+{
+    // This is a simulated annealing search over sets of clues taken from a solved board. Each move adds a clue from the solution,
+    // and if the puzzle is too easy, it also removes other clues. Every puzzle visited has a unique solution. Moves that take the
+    // puzzle farther from the target range are occasionally accepted in order to escape local minima. If the search stalls, it
+    // starts over with a new solved board.
+
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point deadline = Clock::now() + timeLimit;
+
+    // The range is [minDifficulty, maxDifficulty + 1), which is the same as [minDifficulty, the largest float less than
+    // maxDifficulty + 1].
+    if (maxDifficulty <= 0.0f)
+        maxDifficulty = std::numeric_limits<float>::max();
+    else
+        maxDifficulty = std::nextafter(maxDifficulty + 1.0f, 0.0f);
+    XCODE_COMPATIBLE_ASSERT(minDifficulty <= maxDifficulty);
+
+    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+
+    Board bestBoard;
+    float bestDifficulty = 0.0f;
+    float bestDistance   = std::numeric_limits<float>::max();
+
+    do
+    {
+        Board solution = generateSolvedBoard();
+
+        // Start with as few clues as possible
+        Board current = solution;
+        reduce(current, randomizedIndexes());
+        float currentDifficulty = computeDifficulty(current);
+        float currentDistance   = distanceFromRange(currentDifficulty, minDifficulty, maxDifficulty);
+
+        float temperature      = INITIAL_TEMPERATURE;
+        int   sinceImprovement = 0;
+        while (true)
+        {
+            if (currentDistance < bestDistance)
             {
-                board.set(i, x); // Skip this one
-                continue;
+                bestBoard        = current;
+                bestDifficulty   = currentDifficulty;
+                bestDistance     = currentDistance;
+                sinceImprovement = 0;
             }
 
-            // If it is too difficult, then undo and try again
-            float newDifficulty = computeDifficulty(board);
-            if (maxDifficulty > 0.0f && newDifficulty >= maxDifficulty + 1.0f)
+            if (bestDistance <= 0.0f || sinceImprovement >= RESTART_THRESHOLD || Clock::now() >= deadline)
+                break;
+            ++sinceImprovement;
+
+            // Add a random clue from the solution. If the puzzle is too easy, then also remove other clues.
+            Board            candidate = current;
+            std::vector<int> indexes   = randomizedIndexes();
+            auto             added     = std::find_if(indexes.begin(), indexes.end(), [&candidate] (int i) {
+                                                          return candidate.isEmpty(i);
+                                                      });
+            XCODE_COMPATIBLE_ASSERT(added != indexes.end());
+            candidate.set(*added, solution.get(*added));
+            if (currentDifficulty < minDifficulty)
             {
-                board.set(i, x); // Skip this one
-                continue;
+                indexes.erase(added);
+                reduce(candidate, indexes, CLUES_REMOVED);
             }
-            else
+
+            // Rating the candidate is the slowest part of a move, so check the time limit again first
+            if (Clock::now() >= deadline)
+                break;
+
+            // Accept the move if it is closer to the range, or with a probability that decreases as the temperature drops
+            float candidateDifficulty = computeDifficulty(candidate);
+            float candidateDistance   = distanceFromRange(candidateDifficulty, minDifficulty, maxDifficulty);
+            float delta               = candidateDistance - currentDistance;
+            if (delta <= 0.0f || chance(rng()) < expf(-delta / temperature))
             {
-                difficulty = newDifficulty;
+                current           = candidate;
+                currentDifficulty = candidateDifficulty;
+                currentDistance   = candidateDistance;
             }
+            temperature = std::max(temperature * COOLING_RATE, MIN_TEMPERATURE);
         }
-    } while (difficulty < minDifficulty);
+    } while (bestDistance > 0.0f && Clock::now() < deadline);
 
-    return board;
+    board = bestBoard;
+    if (difficulty)
+        *difficulty = bestDifficulty;
+    return bestDistance <= 0.0f;
 }
 
-Board Generator::generateSolvedBoard()
+bool Generator::generateWithTechniques(TechniqueSet              required,
+                                       TechniqueSet              forbidden,
+                                       std::chrono::milliseconds timeLimit,
+                                       Board &                   board)
 {
-    Board board;
-    bool  successful = attempt(board, 0);
-    XCODE_COMPATIBLE_ASSERT(successful);
-    return board;
+    // Clues are removed one at a time. At each step, a few removals that keep the solution unique are rated, and the one whose
+    // solution uses the most required techniques is chosen. Sampling stops early once a removal uses all of them. A removal is
+    // rejected if the solution uses a forbidden technique or if the Analyzer cannot solve it, and as a heuristic, it is not tried
+    // again. Removing more clues can change the solving path and make it acceptable, but usually does not. When no clues remain to
+    // be tried, the board is as reduced as it can be, and it is returned if its solution uses all of the required techniques.
+    //
+    // The board is abandoned early if the number of required techniques used falls below the most seen so far and does not recover
+    // within ABANDON_STEPS steps, since the removals that led to them have been passed by.
+
+    XCODE_COMPATIBLE_ASSERT((required & forbidden) == 0);
+
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point deadline = Clock::now() + timeLimit;
+
+    do
+    {
+        Board            current           = generateSolvedBoard();
+        TechniqueSet     currentTechniques = 0;
+        std::vector<int> remaining         = randomizedIndexes(); // Clues that might still be removable
+        int              fullScore         = countBits(required);
+        int              peakScore         = 0;
+        int              stepsBelowPeak    = 0;
+
+        while (!remaining.empty() && Clock::now() < deadline)
+        {
+            int          bestIndex      = -1;
+            int          bestScore      = -1;
+            TechniqueSet bestTechniques = 0;
+            int          samples        = 0;
+            for (auto p = remaining.begin(); p != remaining.end() && samples < STEERING_SAMPLES;)
+            {
+                int i = *p;
+                int x = current.get(i);
+                current.set(i, Board::EMPTY);
+                TechniqueSet techniques = 0;
+                bool acceptable = remainsUnique(current, i) &&
+                                  computeDifficulty(current, &techniques) < STUCK_DIFFICULTY &&
+                                  (techniques & forbidden) == 0;
+                current.set(i, x); // Undo
+
+                if (!acceptable)
+                {
+                    p = remaining.erase(p);
+                    continue;
+                }
+
+                int score = countBits(techniques & required);
+                if (score > bestScore)
+                {
+                    bestIndex      = i;
+                    bestScore      = score;
+                    bestTechniques = techniques;
+                }
+                if (bestScore == fullScore)
+                    break;
+                ++samples;
+                ++p;
+            }
+
+            // If no more clues can be removed, then the board is finished
+            if (bestIndex < 0)
+                break;
+
+            current.set(bestIndex, Board::EMPTY);
+            currentTechniques = bestTechniques;
+            remaining.erase(std::find(remaining.begin(), remaining.end(), bestIndex));
+
+            // Give up on the board if it has lost required techniques that it used earlier and is not getting them back
+            if (bestScore >= peakScore)
+            {
+                peakScore      = bestScore;
+                stepsBelowPeak = 0;
+            }
+            else if (++stepsBelowPeak > ABANDON_STEPS)
+            {
+                break;
+            }
+        }
+
+        // The board is finished only if every remaining clue was tried and rejected
+        if (remaining.empty() && (currentTechniques & required) == required)
+        {
+            board = current;
+            return true;
+        }
+    } while (Clock::now() < deadline);
+
+    return false;
 }
 
-bool Generator::attempt(Board & board, int i)
+Board Generator::isomorph(Board const & board)
 {
-    // This function attempts to find a solution recursively by attempting all possible values for the specified cell in random
-    // order until values can be found for all of the following cells.
+    return Transform::random(rng()).apply(board);
+}
 
-    // If there are no remaining cells to try, then the board has been generated
-    if (i >= Board::NUM_CELLS)
-        return true;
+Generator::Stats Generator::stats()
+{
+    Stats s;
+    s.solvedBoards       = counters.solvedBoards;
+    s.removals           = counters.removals;
+    s.notUnique          = counters.notUnique;
+    s.tooDifficult       = counters.tooDifficult;
+    s.tooEasy            = counters.tooEasy;
+    s.uniquenessSearches = counters.uniquenessSearches;
+    s.uniquenessSkipped  = counters.uniquenessSkipped;
+    s.uniquenessCached   = counters.uniquenessCached;
+    s.uniquenessTime     = std::chrono::nanoseconds(counters.uniquenessTime);
+    s.difficultyTime     = std::chrono::nanoseconds(counters.difficultyTime);
+    return s;
+}
 
-    // Generate all the candidates for this cell. If there are none, then the board is not viable.
-    std::vector<int> possibleValues = board.candidates(i);
-    if (possibleValues.empty())
+void Generator::resetStats()
+{
+    counters.solvedBoards       = 0;
+    counters.removals           = 0;
+    counters.notUnique          = 0;
+    counters.tooDifficult       = 0;
+    counters.tooEasy            = 0;
+    counters.uniquenessSearches = 0;
+    counters.uniquenessSkipped  = 0;
+    counters.uniquenessCached   = 0;
+    counters.uniquenessTime     = 0;
+    counters.difficultyTime     = 0;
+}
+
+void Generator::seed(unsigned s)
+{
+    rng().seed(s);
+}
+
+std::string Generator::randomState()
+{
+    std::ostringstream stream;
+    stream << rng();
+    return stream.str();
+}
+
+bool Generator::setRandomState(std::string const & state)
+{
+    std::istringstream stream(state);
+    std::mt19937       restored;
+    stream >> restored;
+    if (stream.fail())
         return false;
+    rng() = restored;
+    return true;
+}
+
+namespace
+{
+// A depth-first search over values for the cells of a pattern. The cell with the fewest candidates is assigned next, and an
+// assignment is abandoned as soon as the clues so far have no solution. When every cell is assigned, the clues are accepted if they
+// have exactly one solution.
+class PatternSearch
+{
+public:
+    using Clock = std::chrono::steady_clock;
 
-    std::random_shuffle(possibleValues.begin(), possibleValues.end());
-    for (auto x : possibleValues)
+    PatternSearch(std::vector<int> const & cells, Clock::time_point deadline, std::atomic<bool> const & found)
+        : cells_(cells)
+        , deadline_(deadline)
+        , found_(found)
     {
-        board.set(i, x);
+    }
 
-        // Try to fill in the remaining cells. If that succeeds, then the board has been generated
-        if (attempt(board, i + 1))
-            return true;
+    // Searches from an empty grid until the node limit is reached. Returns true if clues with a unique solution are found.
+    bool run(std::mt19937 & rng, int nodeLimit, Grid & grid)
+    {
+        grid       = Grid();
+        nodesLeft_ = nodeLimit;
+        return branch(rng, grid);
     }
 
-    // None of the candidates for this cell worked, so it isn't viable
-    board.set(i, Board::EMPTY); // Undo any attempt in this cell
-    return false;
+private:
+    bool branch(std::mt19937 & rng, Grid & grid)
+    {
+        if (--nodesLeft_ < 0 || found_ || Clock::now() >= deadline_)
+            return false;
+
+        // Find the unassigned cell with the fewest candidates. If every cell is assigned, then the solution must be unique.
+        int      best      = -1;
+        int      bestCount = Board::SIZE + 1;
+        unsigned bestMask  = 0;
+        for (int i : cells_)
+        {
+            if (grid.get(i) == Board::EMPTY)
+            {
+                unsigned c = grid.candidates(i);
+                int      n = countBits(c);
+                if (n < bestCount)
+                {
+                    best      = i;
+                    bestCount = n;
+                    bestMask  = c;
+                }
+            }
+        }
+        if (best < 0)
+            return grid.countSolutions(2) == 1;
+
+        int order[Board::SIZE];
+        int n = 0;
+        for (int x = 1; x <= Board::SIZE; ++x)
+        {
+            if (bestMask & (1u << x))
+                order[n++] = x;
+        }
+        std::shuffle(order, order + n, rng);
+
+        for (int k = 0; k < n; ++k)
+        {
+            grid.set(best, order[k]);
+            if (grid.countSolutions(1) > 0 && branch(rng, grid))
+                return true;
+        }
+        grid.set(best, Board::EMPTY);
+        return false;
+    }
+
+    std::vector<int> const &  cells_;
+    Clock::time_point         deadline_;
+    std::atomic<bool> const & found_;
+    int                       nodesLeft_ = 0;
+};
+} // anonymous namespace
+
+bool Generator::generateWithPattern(Pattern const & pattern, std::chrono::milliseconds timeLimit, Board & board)
+{
+    std::vector<int> cells;
+    for (int i = 0; i < Board::NUM_CELLS; ++i)
+    {
+        if (pattern.test(i))
+            cells.push_back(i);
+    }
+
+    // Each core runs its own search, and the first one to succeed supplies the board
+    PatternSearch::Clock::time_point deadline = PatternSearch::Clock::now() + timeLimit;
+    std::atomic<bool>                found(false);
+    std::mutex                       mutex;
+    int                              threads = std::max(1, (int)std::thread::hardware_concurrency());
+    parallelFor(threads, [&cells, deadline, &found, &mutex, &board] (int) {
+        PatternSearch search(cells, deadline, found);
+        Grid          grid;
+        while (!found && PatternSearch::Clock::now() < deadline)
+        {
+            if (search.run(rng(), NODES_PER_PATTERN_ATTEMPT, grid))
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!found)
+                {
+                    board = grid.board();
+                    found = true;
+                }
+            }
+        }
+    });
+
+    return found;
+}
+
+Board Generator::generateSolvedBoard()
+{
+    ++counters.solvedBoards;
+    Grid grid;
+    bool successful = grid.fill(rng());
+    XCODE_COMPATIBLE_ASSERT(successful);
+    (void)successful;
+    return grid.board();
+}
+
+std::vector<Board> Generator::generateSolvedBoards(int count, int variantsPerBoard /* = DEFAULT_VARIANTS_PER_BOARD*/)
+{
+    XCODE_COMPATIBLE_ASSERT(count >= 0);
+    XCODE_COMPATIBLE_ASSERT(variantsPerBoard >= 0);
+
+    std::vector<Board> boards;
+    boards.reserve(count);
+    while ((int)boards.size() < count)
+    {
+        Board board = generateSolvedBoard();
+        boards.push_back(board);
+        for (int v = 0; v < variantsPerBoard && (int)boards.size() < count; ++v)
+        {
+            boards.push_back(isomorph(board));
+        }
+    }
+    return boards;
 }
 
 std::vector<int> Generator::randomizedIndexes()
 {
     std::vector<int> indexes(Board::NUM_CELLS);
     std::iota(indexes.begin(), indexes.end(), 0);
-    std::random_shuffle(indexes.begin(), indexes.end());
+    std::shuffle(indexes.begin(), indexes.end(), rng());
     return indexes;
 }
 
-float Generator::computeDifficulty(Board const & board)
+void Generator::reduce(Board & board, std::vector<int> const & indexes, int limit /* = -1*/)
+{
+    // Remove the clues in the given order as long as the solution remains unique, until the limit (if any) is reached
+    for (auto i : indexes)
+    {
+        if (limit == 0)
+            break;
+        if (board.isEmpty(i))
+            continue;
+
+        int x = board.get(i);
+        board.set(i, Board::EMPTY);
+        if (remainsUnique(board, i))
+        {
+            if (limit > 0)
+                --limit;
+        }
+        else
+        {
+            board.set(i, x); // Undo
+        }
+    }
+}
+
+Board Generator::carve(Board const & solution, float maxDifficulty, float * difficulty, Cache * cache /* = nullptr*/)
 {
+    Board board = solution;
+    *difficulty = 0.0f;
+
+    // Randomly remove as many cells as possible
+    std::vector<int> indexes = randomizedIndexes();
+    for (auto i : indexes)
+    {
+        // Remove a cell
+        int x = board.get(i);
+        board.set(i, Board::EMPTY);
+
+        // If the new puzzle doesn't have a unique solution, then undo and try again
+        if (!remainsUnique(board, i, cache))
+        {
+            board.set(i, x); // Skip this one
+            continue;
+        }
+
+        // If it is too difficult, then undo and try again
+        float newDifficulty;
+        if (cache)
+        {
+            Pattern clues = cluesOf(board);
+            auto    found = cache->difficulties.find(clues);
+            if (found == cache->difficulties.end())
+                found = cache->difficulties.emplace(clues, computeDifficulty(board)).first;
+            newDifficulty = found->second;
+        }
+        else
+        {
+            newDifficulty = computeDifficulty(board);
+        }
+        if (maxDifficulty > 0.0f && newDifficulty >= maxDifficulty + 1.0f)
+        {
+            ++counters.tooDifficult;
+            board.set(i, x); // Skip this one
+            continue;
+        }
+        else
+        {
+            *difficulty = newDifficulty;
+        }
+    }
+    return board;
+}
+
+bool Generator::remainsUnique(Board const & board, int i, Cache * cache /* = nullptr*/)
+{
+    ++counters.removals;
+    bool unique = checkUnique(board, i, cache);
+    if (!unique)
+        ++counters.notUnique;
+    return unique;
+}
+
+bool Generator::checkUnique(Board const & board, int i, Cache * cache)
+{
+    // The clue at i has just been removed from a board with a unique solution. If the other clues force its value through singles,
+    // then they have the same solutions as before, so the expensive search is unnecessary.
+    if (Grid(board).forcedBySingles(i))
+    {
+        ++counters.uniquenessSkipped;
+        return true;
+    }
+
+    if (!cache)
+    {
+        ++counters.uniquenessSearches;
+        ScopedTimer timer(counters.uniquenessTime);
+        return Solver::hasUniqueSolution(board);
+    }
+
+    // Removing clues never makes a solution unique, so a set of clues is unique if it contains a set known to be unique. If the
+    // clues miss every cell of an unavoidable set, then the other solution that differs from the solution there fits the clues too.
+    Pattern clues = cluesOf(board);
+    for (auto const & u : cache->unique)
+    {
+        if ((u & ~clues).none())
+        {
+            ++counters.uniquenessCached;
+            return true;
+        }
+    }
+    for (auto const & d : cache->unavoidable)
+    {
+        if ((clues & d).none())
+        {
+            ++counters.uniquenessCached;
+            return false;
+        }
+    }
+
+    // Search for a second solution, and remember the result
+    ++counters.uniquenessSearches;
+    Grid solutions[2];
+    int  n;
+    {
+        ScopedTimer timer(counters.uniquenessTime);
+        n = Grid(board).countSolutions(2, solutions);
+    }
+    if (n < 2)
+    {
+        cache->unique.push_back(clues);
+        return true;
+    }
+
+    // At least one of the two solutions differs from the solution
+    for (auto const & other : solutions)
+    {
+        Pattern unavoidable;
+        for (int j = 0; j < Board::NUM_CELLS; ++j)
+        {
+            unavoidable[j] = other.get(j) != cache->solution.get(j);
+        }
+        if (unavoidable.any())
+        {
+            cache->unavoidable.push_back(unavoidable);
+            break;
+        }
+    }
+    return false;
+}
+
+float Generator::computeDifficulty(Board const & board, TechniqueSet * techniques /* = nullptr*/)
+{
+    ScopedTimer timer(counters.difficultyTime);
     Analyzer analyzer(board);
 
     // Solve it, saving each step
@@ -115,10 +910,20 @@ float Generator::computeDifficulty(Board const & board)
         steps.push_back(analyzer.next());
     } while (!analyzer.done());
 
+    if (techniques)
+    {
+        *techniques = 0;
+        for (auto const & step : steps)
+        {
+            if (step.technique != Analyzer::Step::NONE)
+                *techniques |= TechniqueSet(1) << step.technique;
+        }
+    }
+
     float overallDifficulty;
     if (analyzer.stuck())
     {
-        overallDifficulty = 9001.0f;
+        overallDifficulty = STUCK_DIFFICULTY;
     }
     else
     {
@@ -159,3 +964,9 @@ float Generator::computeDifficulty(Board const & board)
     }
     return overallDifficulty;
 }
+
+std::mt19937 & Generator::rng()
+{
+    static thread_local std::mt19937 s_rng{ std::random_device{}() };
+    return s_rng;
+}
@@ -2,6 +2,11 @@
 #define GENERATOR_GENERATOR_H_INCLUDED 1
 #pragma once
 
+#include <bitset>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
 #include <vector>
 
 class Board;
@@ -10,15 +15,130 @@ class Board;
 class Generator
 {
 public:
+    static int constexpr DEFAULT_VARIANTS_PER_BOARD = 15; // Default number of isomorphs derived from each synthesized solved board
+
+    // A set of techniques, with bit (1 << id) set for each Analyzer::Step::TechniqueId in the set
+    using TechniqueSet = uint32_t;
+
+    // Counts of the work done by all threads. A uniqueness check after removing a clue is skipped when the remaining clues force
+    // the removed clue's value back through naked and hidden singles, since then the solution must still be unique.
+    struct Stats
+    {
+        uint64_t                 solvedBoards;          // Number of solved boards synthesized
+        uint64_t                 removals;              // Number of clue removals attempted
+        uint64_t                 notUnique;             // Number of removals undone because the solution was no longer unique
+        uint64_t                 tooDifficult;          // Number of removals undone because the board exceeded the maximum difficulty
+        uint64_t                 tooEasy;               // Number of boards discarded for being below the minimum difficulty
+        uint64_t                 uniquenessSearches;    // Number of uniqueness checks that searched for a second solution
+        uint64_t                 uniquenessSkipped;     // Number of uniqueness checks that were skipped
+        uint64_t                 uniquenessCached;      // Number of uniqueness checks answered by earlier results for the same
+                                                        // solution (see generateFromSolution())
+        std::chrono::nanoseconds uniquenessTime;        // Time spent searching for second solutions
+        std::chrono::nanoseconds difficultyTime;        // Time spent in computeDifficulty()
+    };
+
+    // A set of cells, with bit i set for each cell index i in the set
+    using Pattern = std::bitset<81>;
+
+    // Difficulty ranges: A board is in the range given by maxDifficulty and minDifficulty if its difficulty is at least
+    // minDifficulty and less than maxDifficulty + 1. Since a board's difficulty is the difficulty of its hardest technique plus
+    // less than 1 (see computeDifficulty()), a maximum of 9 allows every board whose hardest technique has a difficulty of 9 or
+    // less. A maxDifficulty of 0 means there is no maximum.
 
     // Generates a random board with the given difficulty
     static Board generate(float maxDifficulty = 0.0f, float minDifficulty = 0.0f);
 
+    // Generates up to count different boards with the given difficulty from one solved board, each by removing clues in a different
+    // random order. The boards share the results of uniqueness checks and ratings. In particular, every second solution found
+    // gives a set of cells where it differs from the solution, and any later set of clues that misses all of them cannot be unique.
+    // Fewer boards are returned if the solution does not readily yield count boards in the difficulty range.
+    static std::vector<Board> generateFromSolution(Board const & solution,
+                                                   int           count,
+                                                   float         maxDifficulty = 0.0f,
+                                                   float         minDifficulty = 0.0f);
+
+    // Generates a random minimal board with the given difficulty. A board is minimal if it has a unique solution and removing any
+    // one of its clues would make the solution not unique.
+    static Board generateMinimal(float maxDifficulty = 0.0f, float minDifficulty = 0.0f);
+
+    // Searches for a minimal board with at most maxClues clues. Clues are removed from random solved boards in every order, using
+    // branch-and-bound to skip orders that cannot do better than the best board found so far. Returns false if no such board is
+    // found within the time limit, in which case board is the minimal board with the fewest clues that was found, or is left
+    // unchanged if none was found.
+    static bool searchMinimal(int maxClues, std::chrono::milliseconds timeLimit, Board & board);
+
+    // Returns the clues that can each be removed without making the solution not unique. The board must have a unique solution,
+    // and it is minimal if there are none. The clues are tested in parallel on all cores.
+    static std::vector<int> redundantClues(Board const & board);
+
+    // Searches for a board with a difficulty in the range given by maxDifficulty and minDifficulty by adding and removing clues while
+    // maintaining a unique solution. The search ends when a board in the range is found or the time limit expires. Returns false if
+    // no board in the range was found, in which case board is the board closest to the range. If difficulty is not null, the
+    // difficulty of the board is stored there.
+    static bool search(float                     maxDifficulty,
+                       float                     minDifficulty,
+                       std::chrono::milliseconds timeLimit,
+                       Board &                   board,
+                       float *                   difficulty = nullptr);
+
+    // Generates a random board whose solution uses all of the techniques in required and none of the techniques in forbidden. Clues
+    // are removed until no clue can be removed without using a forbidden technique or losing the unique solution. Returns false if
+    // no such board is found within the time limit.
+    static bool generateWithTechniques(TechniqueSet              required,
+                                       TechniqueSet              forbidden,
+                                       std::chrono::milliseconds timeLimit,
+                                       Board &                   board);
+
+    // Generates a random board whose clues are exactly the cells in the pattern. Values are assigned to the cells of the pattern one
+    // at a time, abandoning an assignment as soon as the clues so far have no solution, or once they are all assigned and have more
+    // than one. The search runs on all cores. Returns false if no such board is found within the time limit.
+    static bool generateWithPattern(Pattern const & pattern, std::chrono::milliseconds timeLimit, Board & board);
+
+    // Returns a random solved board.
+    //
+    // The board is synthesized by repeatedly filling the most constrained empty cell with a random candidate and backtracking on a
+    // dead end. Every solved board can be produced, but the distribution is not exactly uniform: the probability of a board is the
+    // product of the probabilities of the choices that lead to it, and that varies somewhat from board to board. No board or
+    // pattern is systematically favored.
+    static Board generateSolvedBoard();
+
+    // Returns random solved boards. Each synthesized board (see generateSolvedBoard()) is followed by up to variantsPerBoard random
+    // isomorphs of it (see Transform), which are much cheaper to produce. An isomorph is uniformly distributed among the boards
+    // equivalent to the synthesized board, so the boards in the list are as varied as the ones from generateSolvedBoard(), except
+    // that each group of variantsPerBoard + 1 consecutive boards are equivalent to each other.
+    static std::vector<Board> generateSolvedBoards(int count, int variantsPerBoard = DEFAULT_VARIANTS_PER_BOARD);
+
+    // Returns a random puzzle that is equivalent to the given one (see Transform). No solving or rating is done.
+    static Board isomorph(Board const & board);
+
+    // Returns the difficulty of a puzzle, or a value over 9000 if the Analyzer cannot solve it. The techniques used are returned in
+    // *techniques if techniques is not null.
+    static float computeDifficulty(Board const & board, TechniqueSet * techniques = nullptr);
+
+    // Returns the counts of the work done by all threads since the last reset
+    static Stats stats();
+
+    // Resets the counts of the work done
+    static void resetStats();
+
+    // Seeds the random number generator used by the calling thread
+    static void seed(unsigned s);
+
+    // Returns the state of the random number generator used by the calling thread, for saving a checkpoint
+    static std::string randomState();
+
+    // Restores the state of the random number generator used by the calling thread. Returns false if the state is invalid.
+    static bool setRandomState(std::string const & state);
+
 private:
-    static Board            generateSolvedBoard();
-    static bool             attempt(Board & b, int i);
+    struct Cache;
+
+    static Board            carve(Board const & solution, float maxDifficulty, float * difficulty, Cache * cache = nullptr);
     static std::vector<int> randomizedIndexes();
-    static float            computeDifficulty(Board const & board);
+    static bool             remainsUnique(Board const & board, int i, Cache * cache = nullptr);
+    static bool             checkUnique(Board const & board, int i, Cache * cache);
+    static void             reduce(Board & board, std::vector<int> const & indexes, int limit = -1);
+    static std::mt19937 &   rng();
 };
 
 #endif // defined(GENERATOR_GENERATOR_H_INCLUDED)
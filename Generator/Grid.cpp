@@ -0,0 +1,247 @@
+#include "Grid.h"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace
+{
+// Returns the number of bits set
+int countBits(unsigned bits)
+{
+    int count = 0;
+    for (; bits != 0; bits &= bits - 1)
+    {
+        ++count;
+    }
+    return count;
+}
+
+// Returns the lowest value in a mask of (1 << value)
+int lowestValue(unsigned mask)
+{
+    int x = 0;
+    while ((mask & (1u << x)) == 0)
+    {
+        ++x;
+    }
+    return x;
+}
+} // anonymous namespace
+
+Grid::Grid(Board const & board)
+{
+    for (int i = 0; i < Board::NUM_CELLS; ++i)
+    {
+        set(i, board.get(i));
+    }
+}
+
+void Grid::set(int i, int x)
+{
+    unsigned mask = ((1u << values_[i]) ^ (1u << x)) & ALL_VALUES; // Remove the old value and add the new one
+    rows_[Board::Group::whichRow(i)]       ^= mask;
+    columns_[Board::Group::whichColumn(i)] ^= mask;
+    boxes_[Board::Group::whichBox(i)]      ^= mask;
+    values_[i] = x;
+}
+
+unsigned Grid::candidates(int i) const
+{
+    unsigned used = rows_[Board::Group::whichRow(i)] |
+                    columns_[Board::Group::whichColumn(i)] |
+                    boxes_[Board::Group::whichBox(i)];
+    return ~used & ALL_VALUES;
+}
+
+bool Grid::fill(std::mt19937 & rng)
+{
+    // If there are no empty cells, then the grid is filled. If a cell has no candidates, then this is a dead end.
+    unsigned c;
+    int      best = mostConstrained(&c);
+    if (best < 0)
+        return true;
+    if (c == 0)
+        return false;
+
+    int order[Board::SIZE];
+    int n = 0;
+    for (int x = 1; x <= Board::SIZE; ++x)
+    {
+        if (c & (1u << x))
+            order[n++] = x;
+    }
+    std::shuffle(order, order + n, rng);
+
+    for (int k = 0; k < n; ++k)
+    {
+        set(best, order[k]);
+        if (fill(rng))
+            return true;
+    }
+    set(best, Board::EMPTY);
+    return false;
+}
+
+int Grid::countSolutions(int limit, Grid * solutions /* = nullptr*/) const
+{
+    Grid copy(*this);
+    int  n = 0;
+    copy.count(limit, n, solutions);
+    return n;
+}
+
+bool Grid::forcedBySingles(int target) const
+{
+    Grid grid(*this);
+    bool progress = true;
+    while (progress)
+    {
+        progress = false;
+
+        // Naked singles
+        for (int i = 0; i < Board::NUM_CELLS; ++i)
+        {
+            if (grid.values_[i] == Board::EMPTY)
+            {
+                unsigned c = grid.candidates(i);
+                if (c == 0)
+                    return false;
+                if ((c & (c - 1)) == 0)
+                {
+                    if (i == target)
+                        return true;
+                    grid.set(i, lowestValue(c));
+                    progress = true;
+                }
+            }
+        }
+
+        // Hidden singles
+        int      cell = -1;
+        unsigned value;
+        if (!grid.hiddenSingle(&cell, &value))
+            return false;
+        if (cell >= 0)
+        {
+            if (cell == target)
+                return true;
+            grid.set(cell, lowestValue(value));
+            progress = true;
+        }
+    }
+    return false;
+}
+
+Board Grid::board() const
+{
+    return Board(std::vector<int>(std::begin(values_), std::end(values_)));
+}
+
+bool Grid::hiddenSingle(int * cell, unsigned * value) const
+{
+    for (int g = 0; g < Board::SIZE * 3; ++g)
+    {
+        // Find the values that have exactly one place in the group
+        int      type  = g / Board::SIZE;
+        int      which = g % Board::SIZE;
+        unsigned once  = 0;
+        unsigned more  = 0;
+        unsigned used  = 0;
+        int      cells[Board::SIZE];
+        for (int k = 0; k < Board::SIZE; ++k)
+        {
+            int i;
+            if (type == 0)
+                i = which * Board::SIZE + k;
+            else if (type == 1)
+                i = k * Board::SIZE + which;
+            else
+                i = ((which / Board::BOX_SIZE) * Board::BOX_SIZE + k / Board::BOX_SIZE) * Board::SIZE +
+                    (which % Board::BOX_SIZE) * Board::BOX_SIZE + k % Board::BOX_SIZE;
+            cells[k] = i;
+            if (values_[i] != Board::EMPTY)
+            {
+                used |= 1u << values_[i];
+            }
+            else
+            {
+                unsigned c = candidates(i);
+                more |= once & c;
+                once |= c;
+            }
+        }
+
+        // If a missing value has no place in the group, then this is a dead end
+        if ((once | used) != ALL_VALUES)
+            return false;
+
+        once &= ~more;
+        if (once != 0)
+        {
+            unsigned x = once & (0u - once); // Lowest value
+            for (int i : cells)
+            {
+                if (values_[i] == Board::EMPTY && (candidates(i) & x))
+                {
+                    *cell  = i;
+                    *value = x;
+                    return true;
+                }
+            }
+        }
+    }
+
+    // Nothing is forced, so the cell and candidates are left as they are
+    return true;
+}
+
+int Grid::mostConstrained(unsigned * candidates) const
+{
+    int      best      = -1;
+    int      bestCount = Board::SIZE + 1;
+    unsigned bestMask  = 0;
+    for (int i = 0; i < Board::NUM_CELLS && bestCount > 1; ++i)
+    {
+        if (values_[i] == Board::EMPTY)
+        {
+            unsigned c = this->candidates(i);
+            int      n = countBits(c);
+            if (n < bestCount)
+            {
+                best      = i;
+                bestCount = n;
+                bestMask  = c;
+            }
+        }
+    }
+    *candidates = bestMask;
+    return best;
+}
+
+void Grid::count(int limit, int & n, Grid * solutions)
+{
+    unsigned c;
+    int      best = mostConstrained(&c);
+    if (best < 0)
+    {
+        if (solutions)
+            solutions[n] = *this;
+        ++n;
+        return;
+    }
+
+    // If no cell is forced, then look for a value that has only one place in a row, column or box
+    if (countBits(c) > 1 && !hiddenSingle(&best, &c))
+        return;
+
+    for (int x = 1; x <= Board::SIZE && n < limit; ++x)
+    {
+        if (c & (1u << x))
+        {
+            set(best, x);
+            count(limit, n, solutions);
+        }
+    }
+    set(best, Board::EMPTY);
+}
@@ -0,0 +1,63 @@
+#if !defined(GENERATOR_GRID_H_INCLUDED)
+#define GENERATOR_GRID_H_INCLUDED 1
+#pragma once
+
+#include "Board/Board.h"
+
+#include <random>
+
+// A compact board used by the Generator for filling and counting solutions. The values used in each row, column and box are kept as
+// masks of (1 << value), so the candidates of a cell are found without scanning the board.
+class Grid
+{
+public:
+    // Constructs an empty grid
+    Grid() = default;
+
+    // Constructs a grid with the values of a board
+    explicit Grid(Board const & board);
+
+    // Sets the value of a cell (1 - 9, or Board::EMPTY)
+    void set(int i, int x);
+
+    // Returns the value of a cell (1 - 9, or Board::EMPTY)
+    int get(int i) const { return values_[i]; }
+
+    // Returns the values that can be placed in a cell without conflicting with the values in its row, column and box, as a mask of
+    // (1 << value)
+    unsigned candidates(int i) const;
+
+    // Fills the empty cells with random values, by repeatedly filling the empty cell with the fewest candidates and backtracking on
+    // a dead end. Returns false if they cannot be filled.
+    bool fill(std::mt19937 & rng);
+
+    // Returns the number of solutions, counting no further than limit. If solutions is not null, the solutions found are returned in
+    // solutions[0] through solutions[n - 1], so it must have room for limit grids.
+    int countSolutions(int limit, Grid * solutions = nullptr) const;
+
+    // Returns true if repeatedly placing naked and hidden singles fills the given empty cell. If the grid has a solution, the value
+    // placed is the cell's value in every solution.
+    bool forcedBySingles(int i) const;
+
+    // Returns the values as a board
+    Board board() const;
+
+    static unsigned constexpr ALL_VALUES = 0x3fe;   // Mask of all values
+
+private:
+    // Returns the empty cell with the fewest candidates, or -1 if there are no empty cells
+    int mostConstrained(unsigned * candidates) const;
+
+    // Finds a value that can only be in one cell of a row, column or box, and returns the cell in *cell and the value (as a mask) in
+    // *value. If there is none, *cell and *value are unchanged. Returns false if a value has no place in a row, column or box.
+    bool hiddenSingle(int * cell, unsigned * value) const;
+
+    void count(int limit, int & n, Grid * solutions);
+
+    unsigned rows_[Board::SIZE]        = {};   // Values used in each row
+    unsigned columns_[Board::SIZE]     = {};   // Values used in each column
+    unsigned boxes_[Board::SIZE]       = {};   // Values used in each box
+    int      values_[Board::NUM_CELLS] = {};   // Value of each cell
+};
+
+#endif // !defined(GENERATOR_GRID_H_INCLUDED)
@@ -0,0 +1,205 @@
+#include "PuzzleBank.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // defined(_WIN32)
+
+#if !defined(XCODE_COMPATIBLE_ASSERT)
+#if defined(_DEBUG)
+#define XCODE_COMPATIBLE_ASSERT assert
+#else
+#define XCODE_COMPATIBLE_ASSERT(...)
+#endif
+#endif // !defined(XCODE_COMPATIBLE_ASSERT)
+
+namespace
+{
+char const SIGNATURE[4] = { 'S', 'D', 'K', 'B' };
+} // anonymous namespace
+
+static_assert(sizeof(PuzzleBank::Record) == 52, "The record layout is part of the file format");
+
+Board PuzzleBank::Record::board() const
+{
+    std::vector<int> values(Board::NUM_CELLS);
+    for (int i = 0; i < Board::NUM_CELLS; ++i)
+    {
+        values[i] = (cells[i / 2] >> ((i % 2) * 4)) & 0xf;
+    }
+    return Board(values);
+}
+
+PuzzleBank::~PuzzleBank()
+{
+    close();
+}
+
+bool PuzzleBank::open(char const * path)
+{
+    close();
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < (LONGLONG)sizeof(Layout))
+    {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    void * data    = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+    if (!data)
+    {
+        if (mapping)
+            CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    file_    = file;
+    mapping_ = mapping;
+    data_    = data;
+    size_    = (size_t)fileSize.QuadPart;
+#else
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat status;
+    if (fstat(fd, &status) != 0 || status.st_size < (off_t)sizeof(Layout))
+    {
+        ::close(fd);
+        return false;
+    }
+    void * data = mmap(nullptr, (size_t)status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED)
+        return false;
+    data_ = data;
+    size_ = (size_t)status.st_size;
+#endif // defined(_WIN32)
+
+    // Validate the header and the index
+    layout_  = static_cast<Layout const *>(data_);
+    records_ = reinterpret_cast<Record const *>(layout_ + 1);
+    Header const & header = layout_->header;
+    bool valid = memcmp(header.signature, SIGNATURE, sizeof(SIGNATURE)) == 0 &&
+                 header.version == VERSION &&
+                 header.recordSize == sizeof(Record) &&
+                 size_ >= sizeof(Layout) + (size_t)header.recordCount * sizeof(Record);
+    for (int d = 0; valid && d < MAX_DIFFICULTY; ++d)
+    {
+        IndexEntry const & entry = layout_->index[d];
+        valid = entry.first <= header.recordCount && entry.count <= header.recordCount - entry.first;
+    }
+    if (!valid)
+    {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void PuzzleBank::close()
+{
+    if (!data_)
+        return;
+
+#if defined(_WIN32)
+    UnmapViewOfFile(data_);
+    CloseHandle(mapping_);
+    CloseHandle(file_);
+    mapping_ = nullptr;
+    file_    = nullptr;
+#else
+    munmap(const_cast<void *>(data_), size_);
+#endif // defined(_WIN32)
+    data_    = nullptr;
+    size_    = 0;
+    layout_  = nullptr;
+    records_ = nullptr;
+}
+
+uint32_t PuzzleBank::count(int difficulty) const
+{
+    if (!layout_ || difficulty < 1 || difficulty > MAX_DIFFICULTY)
+        return 0;
+    return layout_->index[difficulty - 1].count;
+}
+
+PuzzleBank::Record const & PuzzleBank::get(int difficulty, uint32_t index) const
+{
+    XCODE_COMPATIBLE_ASSERT(index < count(difficulty));
+    return records_[layout_->index[difficulty - 1].first + index];
+}
+
+PuzzleBank::Record const * PuzzleBank::random(int difficulty, std::mt19937 & rng) const
+{
+    uint32_t n = count(difficulty);
+    if (n == 0)
+        return nullptr;
+    return &get(difficulty, std::uniform_int_distribution<uint32_t>(0, n - 1)(rng));
+}
+
+bool PuzzleBank::write(char const * path, std::vector<Entry> const & entries)
+{
+    // Sort the records by difficulty and build the index
+    std::vector<Record> byDifficulty[MAX_DIFFICULTY];
+    for (auto const & entry : entries)
+    {
+        int d = whichDifficulty(entry.rating);
+        if (d < 1)
+            continue;
+
+        Record record = {};
+        for (int i = 0; i < Board::NUM_CELLS; ++i)
+        {
+            record.cells[i / 2] |= uint8_t(entry.board.get(i) << ((i % 2) * 4));
+        }
+        record.rating     = entry.rating;
+        record.techniques = entry.techniques;
+        byDifficulty[d - 1].push_back(record);
+    }
+
+    Layout layout = {};
+    memcpy(layout.header.signature, SIGNATURE, sizeof(SIGNATURE));
+    layout.header.version    = VERSION;
+    layout.header.recordSize = sizeof(Record);
+    for (int d = 0; d < MAX_DIFFICULTY; ++d)
+    {
+        layout.index[d].first      = layout.header.recordCount;
+        layout.index[d].count      = (uint32_t)byDifficulty[d].size();
+        layout.header.recordCount += layout.index[d].count;
+    }
+
+    FILE * fp = fopen(path, "wb");
+    if (!fp)
+        return false;
+    bool ok = fwrite(&layout, sizeof(layout), 1, fp) == 1;
+    for (int d = 0; ok && d < MAX_DIFFICULTY; ++d)
+    {
+        if (!byDifficulty[d].empty())
+            ok = fwrite(byDifficulty[d].data(), sizeof(Record), byDifficulty[d].size(), fp) == byDifficulty[d].size();
+    }
+    ok = (fclose(fp) == 0) && ok;
+    return ok;
+}
+
+int PuzzleBank::whichDifficulty(float rating)
+{
+    if (rating >= float(MAX_DIFFICULTY + 1))
+        return -1;
+    int d = std::min((int)std::lround(rating), MAX_DIFFICULTY);
+    return (d >= 1) ? d : -1;
+}
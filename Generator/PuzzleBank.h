@@ -0,0 +1,112 @@
+#if !defined(GENERATOR_PUZZLEBANK_H_INCLUDED)
+#define GENERATOR_PUZZLEBANK_H_INCLUDED 1
+#pragma once
+
+#include "Analyzer/Analyzer.h"
+#include "Board/Board.h"
+#include "Generator/Generator.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// A file of rated puzzles that is memory-mapped and read in place.
+//
+// The file consists of a header, an index, and fixed-size records. The records are sorted by difficulty, rounded to the nearest
+// integer from 1 to MAX_DIFFICULTY (see whichDifficulty()), and the index gives the first record and the number of records for
+// each difficulty, so a puzzle is found by difficulty and index without reading anything else. All values are stored in the byte
+// order of the machine that wrote the file.
+class PuzzleBank
+{
+public:
+    static int constexpr MAX_DIFFICULTY = Analyzer::Step::MAX_TECHNIQUE_DIFFICULTY; // Highest difficulty in the index
+
+    // A rated puzzle as stored in the file
+    struct Record
+    {
+        uint8_t                 cells[(Board::NUM_CELLS + 1) / 2];  // Values packed two per byte, low nibble first
+        uint8_t                 reserved[3];                        // Always 0
+        float                   rating;                             // Difficulty
+        Generator::TechniqueSet techniques;                         // Techniques used to solve it
+
+        // Returns the puzzle
+        Board board() const;
+    };
+
+    // A puzzle and its rating, as given to write()
+    struct Entry
+    {
+        Board                   board;
+        float                   rating;
+        Generator::TechniqueSet techniques;
+    };
+
+    // Constructor
+    PuzzleBank() = default;
+
+    // Destructor
+    ~PuzzleBank();
+
+    PuzzleBank(PuzzleBank const &) = delete;
+    PuzzleBank & operator=(PuzzleBank const &) = delete;
+
+    // Maps the file. Returns false if it cannot be mapped or is not a valid bank file.
+    bool open(char const * path);
+
+    // Unmaps the file
+    void close();
+
+    // Returns the number of puzzles of the given difficulty (1 - MAX_DIFFICULTY)
+    uint32_t count(int difficulty) const;
+
+    // Returns the puzzle with the given index in the list of puzzles of the given difficulty. The index must be less than
+    // count(difficulty).
+    Record const & get(int difficulty, uint32_t index) const;
+
+    // Returns a random puzzle of the given difficulty, or nullptr if there are none
+    Record const * random(int difficulty, std::mt19937 & rng) const;
+
+    // Writes puzzles to a bank file. Puzzles without a difficulty (see whichDifficulty()) are omitted. Returns false if the file
+    // cannot be written.
+    static bool write(char const * path, std::vector<Entry> const & entries);
+
+    // Returns the difficulty (1 - MAX_DIFFICULTY) that a puzzle with the given rating is stored under, or -1 if it has none. A
+    // rating can exceed the difficulty of its hardest technique by up to 1, so ratings that round to MAX_DIFFICULTY + 1 are
+    // stored under MAX_DIFFICULTY. Higher ratings are puzzles that cannot be solved.
+    static int whichDifficulty(float rating);
+
+private:
+    struct Header
+    {
+        char     signature[4];      // "SDKB"
+        uint32_t version;           // VERSION
+        uint32_t recordSize;        // sizeof(Record)
+        uint32_t recordCount;       // Total number of records
+    };
+
+    struct IndexEntry
+    {
+        uint32_t first;             // Index of the first record of the difficulty
+        uint32_t count;             // Number of records of the difficulty
+    };
+
+    struct Layout
+    {
+        Header     header;
+        IndexEntry index[MAX_DIFFICULTY];   // Indexed by difficulty - 1
+    };
+
+    static uint32_t constexpr VERSION = 2;
+
+    void const *   data_    = nullptr;    // The mapped file
+    size_t         size_    = 0;          // Size of the mapped file
+    Layout const * layout_  = nullptr;    // The header and index in the mapped file
+    Record const * records_ = nullptr;    // The records in the mapped file
+#if defined(_WIN32)
+    void * file_    = nullptr;
+    void * mapping_ = nullptr;
+#endif // defined(_WIN32)
+};
+
+#endif // !defined(GENERATOR_PUZZLEBANK_H_INCLUDED)
@@ -0,0 +1,220 @@
+#include "PuzzlePool.h"
+
+#include "Generator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+
+namespace
+{
+// Time spent searching for a puzzle of the chosen difficulty before filing whatever was found. This also bounds the time taken to
+// stop the background threads.
+std::chrono::milliseconds constexpr SEARCH_TIME_LIMIT = std::chrono::seconds(2);
+
+// Longest time an idle background thread sleeps before checking the buckets again
+std::chrono::milliseconds constexpr IDLE_CHECK_INTERVAL = std::chrono::milliseconds(100);
+
+// After a search misses its bucket, the bucket is not chosen again for this long, doubled for each further consecutive miss up to
+// MAX_BACKOFF_DOUBLINGS times.
+std::chrono::milliseconds constexpr BACKOFF_TIME = SEARCH_TIME_LIMIT;
+int constexpr MAX_BACKOFF_DOUBLINGS = 6;
+
+using Clock = std::chrono::steady_clock;
+} // anonymous namespace
+
+PuzzlePool::PuzzlePool(int capacity, int threads /* = 0*/)
+    : capacity_(capacity)
+{
+    if (threads <= 0)
+        threads = std::max(1, (int)std::thread::hardware_concurrency());
+
+    threads_.reserve(threads);
+    for (int i = 0; i < threads; ++i)
+    {
+        threads_.emplace_back(&PuzzlePool::run, this);
+    }
+}
+
+PuzzlePool::~PuzzlePool()
+{
+    {
+        std::lock_guard<std::mutex> lock(idleMutex_);
+        stopping_ = true;
+    }
+    idle_.notify_all();
+
+    for (auto & t : threads_)
+    {
+        t.join();
+    }
+}
+
+bool PuzzlePool::take(float difficulty, Board & board, float * rating /* = nullptr*/)
+{
+    int b = whichBucket(difficulty);
+    if (b < 0)
+    {
+        ++missed_;
+        return false;
+    }
+
+    Bucket & bucket = buckets_[b];
+    {
+        std::lock_guard<std::mutex> lock(bucket.mutex);
+        if (bucket.entries.empty())
+        {
+            ++missed_;
+            return false;
+        }
+        board = bucket.entries.front().first;
+        if (rating)
+            *rating = bucket.entries.front().second;
+        bucket.entries.pop_front();
+        --bucket.size;
+    }
+    ++taken_;
+
+    // Wake a background thread in case all of them are idle. Taking the lock ensures that a thread about to sleep sees the change.
+    {
+        std::lock_guard<std::mutex> lock(idleMutex_);
+    }
+    idle_.notify_one();
+    return true;
+}
+
+int PuzzlePool::size(float difficulty) const
+{
+    int b = whichBucket(difficulty);
+    return (b >= 0) ? buckets_[b].size.load() : 0;
+}
+
+PuzzlePool::Metrics PuzzlePool::metrics() const
+{
+    Metrics m;
+    m.capacity = capacity_;
+    for (int b = 0; b < MAX_DIFFICULTY; ++b)
+    {
+        m.sizes[b]   = buckets_[b].size;
+        m.misses[b]  = buckets_[b].misses;
+        m.waiting[b] = waiting(buckets_[b]);
+    }
+    m.generated      = generated_;
+    m.discarded      = discarded_;
+    m.taken          = taken_;
+    m.missed         = missed_;
+    m.searchesMissed = searchesMissed_;
+    return m;
+}
+
+int PuzzlePool::whichBucket(float difficulty)
+{
+    // A rating is less than the difficulty of its hardest technique + 1, so anything higher is a puzzle that cannot be solved.
+    if (difficulty >= float(MAX_DIFFICULTY + 1))
+        return -1;
+    int d = std::min((int)std::lround(difficulty), MAX_DIFFICULTY);
+    return (d >= 1) ? d - 1 : -1;
+}
+
+void PuzzlePool::run()
+{
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(idleMutex_);
+            if (!idle_.wait_for(lock, IDLE_CHECK_INTERVAL, [this] () { return stopping_ || needed(); }))
+                continue;
+            if (stopping_)
+                break;
+        }
+
+        // The range of a bucket is [difficulty - 0.5, difficulty + 0.5), except that the last bucket also holds the puzzles that
+        // round to one more than its difficulty. The maximum passed to search() is 1 less than the end of the range.
+        int   b          = chooseBucket();
+        float difficulty = float(b + 1);
+        float maximum    = (b == MAX_DIFFICULTY - 1) ? difficulty : difficulty - 0.5f;
+        float rating;
+        Board board;
+        Generator::search(maximum, difficulty - 0.5f, SEARCH_TIME_LIMIT, board, &rating);
+        ++generated_;
+        recordSearch(b, rating);
+        if (!put(board, rating))
+            ++discarded_;
+    }
+}
+
+int PuzzlePool::chooseBucket()
+{
+    static thread_local std::mt19937 rng(std::random_device{}());
+
+    // Choose a bucket that is not full or waiting after misses, weighted by the number of free slots
+    std::array<int, MAX_DIFFICULTY> free;
+    for (int b = 0; b < MAX_DIFFICULTY; ++b)
+    {
+        free[b] = waiting(buckets_[b]) ? 0 : std::max(0, capacity_ - buckets_[b].size);
+    }
+
+    // If the buckets were filled or began waiting since the check, then any bucket will do.
+    int total = 0;
+    for (int f : free)
+    {
+        total += f;
+    }
+    if (total == 0)
+        return std::uniform_int_distribution<int>(0, MAX_DIFFICULTY - 1)(rng);
+
+    int r = std::uniform_int_distribution<int>(0, total - 1)(rng);
+    int b = 0;
+    while (r >= free[b])
+    {
+        r -= free[b];
+        ++b;
+    }
+    return b;
+}
+
+bool PuzzlePool::put(Board const & board, float difficulty)
+{
+    int b = whichBucket(difficulty);
+    if (b < 0)
+        return false;
+
+    Bucket &                    bucket = buckets_[b];
+    std::lock_guard<std::mutex> lock(bucket.mutex);
+    if ((int)bucket.entries.size() >= capacity_)
+        return false;
+    bucket.entries.emplace_back(board, difficulty);
+    ++bucket.size;
+    return true;
+}
+
+void PuzzlePool::recordSearch(int b, float rating)
+{
+    Bucket & bucket = buckets_[b];
+    if (whichBucket(rating) == b)
+    {
+        bucket.misses = 0;
+        return;
+    }
+
+    ++searchesMissed_;
+    int  misses  = ++bucket.misses;
+    auto backoff = BACKOFF_TIME * (1 << std::min(misses - 1, MAX_BACKOFF_DOUBLINGS));
+    bucket.retryTime = (Clock::now() + backoff).time_since_epoch().count();
+}
+
+bool PuzzlePool::waiting(Bucket const & bucket)
+{
+    return Clock::now().time_since_epoch().count() < bucket.retryTime;
+}
+
+bool PuzzlePool::needed() const
+{
+    for (auto const & bucket : buckets_)
+    {
+        if (bucket.size < capacity_ && !waiting(bucket))
+            return true;
+    }
+    return false;
+}
@@ -0,0 +1,102 @@
+#if !defined(GENERATOR_PUZZLEPOOL_H_INCLUDED)
+#define GENERATOR_PUZZLEPOOL_H_INCLUDED 1
+#pragma once
+
+#include "Analyzer/Analyzer.h"
+#include "Board/Board.h"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// An inventory of generated puzzles, bucketed by difficulty and refilled by background threads.
+//
+// Bucket d holds puzzles whose difficulty rounds to d, for d from 1 to MAX_DIFFICULTY, which is the highest difficulty of any
+// technique. The last bucket also holds the puzzles whose difficulty rounds to MAX_DIFFICULTY + 1, since a rating can exceed the
+// difficulty of its hardest technique by up to 1. Each bucket holds at most a fixed number of puzzles. The background threads
+// repeatedly pick a bucket that is not full, at random and weighted by the number of free slots, and search for a puzzle of that
+// difficulty (see Generator::search). The result is added to whichever bucket it belongs in, if there is room. A bucket that a
+// search misses is not chosen again for a while, and the wait doubles with each consecutive miss, so the threads do not spin on a
+// difficulty that they cannot reach. When every bucket is full or waiting, the threads sleep.
+//
+// Taking a puzzle never waits for generation. Each bucket has its own lock, which is held only long enough to remove one puzzle, so
+// consumers contend with each other and with the background threads only briefly.
+class PuzzlePool
+{
+public:
+    static int constexpr MAX_DIFFICULTY = Analyzer::Step::MAX_TECHNIQUE_DIFFICULTY; // Highest difficulty bucket
+
+    // Fill levels and counters
+    struct Metrics
+    {
+        int                               capacity;       // Maximum number of puzzles in each bucket
+        std::array<int, MAX_DIFFICULTY>   sizes;          // Number of puzzles in each bucket, indexed by difficulty - 1
+        std::array<int, MAX_DIFFICULTY>   misses;         // Number of consecutive searches that missed each bucket
+        std::array<bool, MAX_DIFFICULTY>  waiting;        // True for each bucket that is not being searched for after misses
+        uint64_t                          generated;      // Number of puzzles generated
+        uint64_t                          discarded;      // Number of generated puzzles discarded because their bucket was full
+        uint64_t                          taken;          // Number of puzzles taken
+        uint64_t                          missed;         // Number of takes that failed because the bucket was empty
+        uint64_t                          searchesMissed; // Number of searches that missed the bucket they were for
+    };
+
+    // Constructor. Starts the given number of background threads. If threads is 0, one thread per core is started.
+    PuzzlePool(int capacity, int threads = 0);
+
+    // Destructor. Stops the background threads, waiting for any searches in progress to finish.
+    ~PuzzlePool();
+
+    PuzzlePool(PuzzlePool const &) = delete;
+    PuzzlePool & operator=(PuzzlePool const &) = delete;
+
+    // Removes a puzzle from the bucket for the given difficulty (rounded) and returns true, or returns false if that bucket is
+    // empty. The puzzle's exact difficulty is returned in *rating if rating is not null. Never blocks on generation.
+    bool take(float difficulty, Board & board, float * rating = nullptr);
+
+    // Returns the number of puzzles in the bucket for the given difficulty (rounded)
+    int size(float difficulty) const;
+
+    // Returns the current fill levels and counters
+    Metrics metrics() const;
+
+private:
+    using Entry = std::pair<Board, float>;
+
+    struct Bucket
+    {
+        mutable std::mutex   mutex;
+        std::deque<Entry>    entries;
+        std::atomic<int>     size{ 0 };
+        std::atomic<int>     misses{ 0 };       // Number of consecutive searches that missed this bucket
+        std::atomic<int64_t> retryTime{ 0 };    // Steady clock time (in ticks) before which the bucket is not chosen
+    };
+
+    static int  whichBucket(float difficulty);
+    static bool waiting(Bucket const & bucket);
+
+    void run();
+    int  chooseBucket();
+    bool put(Board const & board, float difficulty);
+    void recordSearch(int b, float rating);
+    bool needed() const;
+
+    int                                capacity_;
+    std::array<Bucket, MAX_DIFFICULTY> buckets_;
+    std::vector<std::thread>           threads_;
+    std::atomic<bool>                  stopping_{ false };
+    std::mutex                         idleMutex_;
+    std::condition_variable            idle_;
+    std::atomic<uint64_t>              generated_{ 0 };
+    std::atomic<uint64_t>              discarded_{ 0 };
+    std::atomic<uint64_t>              taken_{ 0 };
+    std::atomic<uint64_t>              missed_{ 0 };
+    std::atomic<uint64_t>              searchesMissed_{ 0 };
+};
+
+#endif // !defined(GENERATOR_PUZZLEPOOL_H_INCLUDED)
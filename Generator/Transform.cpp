@@ -0,0 +1,64 @@
+#include "Transform.h"
+
+#include "Board/Board.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+namespace
+{
+// Fills lines with a permutation of lines that keeps lines within the same band (or stack) together
+void randomLines(int * lines, std::mt19937 & rng)
+{
+    int blocks[Board::BOX_SIZE];
+    std::iota(std::begin(blocks), std::end(blocks), 0);
+    std::shuffle(std::begin(blocks), std::end(blocks), rng);
+
+    for (int b = 0; b < Board::BOX_SIZE; ++b)
+    {
+        int offsets[Board::BOX_SIZE];
+        std::iota(std::begin(offsets), std::end(offsets), 0);
+        std::shuffle(std::begin(offsets), std::end(offsets), rng);
+        for (int o = 0; o < Board::BOX_SIZE; ++o)
+        {
+            lines[b * Board::BOX_SIZE + o] = blocks[b] * Board::BOX_SIZE + offsets[o];
+        }
+    }
+}
+} // anonymous namespace
+
+Transform::Transform()
+    : transpose_(false)
+{
+    std::iota(std::begin(digits_), std::end(digits_), 0);
+    std::iota(std::begin(rows_), std::end(rows_), 0);
+    std::iota(std::begin(columns_), std::end(columns_), 0);
+}
+
+Transform Transform::random(std::mt19937 & rng)
+{
+    Transform t;
+    std::shuffle(std::begin(t.digits_) + 1, std::end(t.digits_), rng); // EMPTY stays EMPTY
+    randomLines(t.rows_, rng);
+    randomLines(t.columns_, rng);
+    t.transpose_ = std::bernoulli_distribution(0.5)(rng);
+    return t;
+}
+
+Board Transform::apply(Board const & board) const
+{
+    Board transformed;
+    for (int r = 0; r < Board::SIZE; ++r)
+    {
+        for (int c = 0; c < Board::SIZE; ++c)
+        {
+            int x = digits_[board.get(rows_[r], columns_[c])];
+            if (transpose_)
+                transformed.set(c, r, x);
+            else
+                transformed.set(r, c, x);
+        }
+    }
+    return transformed;
+}
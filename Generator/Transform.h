@@ -0,0 +1,32 @@
+#if !defined(GENERATOR_TRANSFORM_H_INCLUDED)
+#define GENERATOR_TRANSFORM_H_INCLUDED 1
+#pragma once
+
+#include "Board/Board.h"
+
+#include <random>
+
+// A validity-preserving transformation of a board. It permutes the digits, the bands, the stacks, the rows within each band and the
+// columns within each stack, and then optionally transposes the board. A transformed puzzle has the same number of solutions as the
+// original and is logically identical to it. However, since the Analyzer scans the board in a fixed order, it may find a different
+// sequence of steps for a transformed puzzle, so the rating may differ slightly.
+class Transform
+{
+public:
+    // Constructs the identity transformation
+    Transform();
+
+    // Returns a transformation chosen uniformly from all 9! * 6^8 * 2 transformations
+    static Transform random(std::mt19937 & rng);
+
+    // Returns the transformed board
+    Board apply(Board const & board) const;
+
+private:
+    int  digits_[Board::SIZE + 1];  // New value of each value, indexed by value (EMPTY maps to EMPTY)
+    int  rows_[Board::SIZE];        // Row in the original board of each row in the transformed board
+    int  columns_[Board::SIZE];     // Column in the original board of each column in the transformed board
+    bool transpose_;                // True if the board is transposed after the rows and columns are permuted
+};
+
+#endif // defined(GENERATOR_TRANSFORM_H_INCLUDED)
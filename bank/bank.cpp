@@ -0,0 +1,209 @@
+#include "Board/Board.h"
+#include "Generator/Generator.h"
+#include "Generator/PuzzleBank.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+static int constexpr DEFAULT_COUNT      = 100;   // Default number of puzzles of each difficulty
+static int constexpr DEFAULT_TIME_LIMIT = 60;    // Default time limit in seconds
+static int constexpr DEFAULT_VARIANTS   = 0;     // Default number of isomorphs added for each generated puzzle
+static int constexpr SEARCH_TIME_LIMIT  = 2;     // Time limit in seconds for each search
+
+static void syntax()
+{
+    fprintf(stderr, "syntax: bank [-n <count>] [-t <seconds>] [-i <variants>] <file>\n");
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -n <count>:     generates up to this many puzzles of each difficulty (default: %d)\n", DEFAULT_COUNT);
+    fprintf(stderr, "  -t <seconds>:   stops generating after this long (default: %d)\n", DEFAULT_TIME_LIMIT);
+    fprintf(stderr, "  -i <variants>:  also adds this many random equivalent puzzles of each generated puzzle (default: %d)\n",
+            DEFAULT_VARIANTS);
+}
+
+namespace
+{
+// Puzzles collected by the worker threads, by difficulty
+class Collection
+{
+public:
+    explicit Collection(int count)
+        : count_(count)
+        , sizes_(PuzzleBank::MAX_DIFFICULTY, 0)
+    {
+    }
+
+    // Adds a puzzle if its difficulty is not full. Returns false if it is not added.
+    bool add(Board const & board, float rating, Generator::TechniqueSet techniques)
+    {
+        int d = PuzzleBank::whichDifficulty(rating);
+        if (d < 1)
+            return false;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (sizes_[d - 1] >= count_)
+            return false;
+        ++sizes_[d - 1];
+        entries_.push_back({ board, rating, techniques });
+        return true;
+    }
+
+    // Returns a difficulty that is not full, chosen at random and weighted by the number of puzzles needed, or 0 if all are full
+    int choose(std::mt19937 & rng)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        int total = 0;
+        for (int size : sizes_)
+        {
+            total += count_ - size;
+        }
+        if (total == 0)
+            return 0;
+
+        int r = std::uniform_int_distribution<int>(0, total - 1)(rng);
+        int d = 0;
+        while (r >= count_ - sizes_[d])
+        {
+            r -= count_ - sizes_[d];
+            ++d;
+        }
+        return d + 1;
+    }
+
+    std::vector<PuzzleBank::Entry> const & entries() const { return entries_; }
+    std::vector<int> const &               sizes() const { return sizes_; }
+
+private:
+    int                            count_;
+    std::vector<int>               sizes_;
+    std::vector<PuzzleBank::Entry> entries_;
+    std::mutex                     mutex_;
+};
+} // anonymous namespace
+
+int main(int argc, char ** argv)
+{
+    --argc;
+    ++argv;
+
+    int   count     = DEFAULT_COUNT;
+    float timeLimit = (float)DEFAULT_TIME_LIMIT;
+    int   variants  = DEFAULT_VARIANTS;
+
+    while (argc > 0 && **argv == '-')
+    {
+        if (strcmp(*argv, "-n") == 0 && argc > 1)
+        {
+            ++argv;
+            --argc;
+            count = atoi(*argv);
+            if (count <= 0)
+            {
+                fprintf(stderr, "bank: The count must be greater than 0.\n");
+                return 1;
+            }
+        }
+        else if (strcmp(*argv, "-t") == 0 && argc > 1)
+        {
+            ++argv;
+            --argc;
+            timeLimit = 0.0f;
+            (void)sscanf(*argv, "%f", &timeLimit);
+            if (timeLimit <= 0.0f)
+            {
+                fprintf(stderr, "bank: The time limit must be greater than 0.\n");
+                return 1;
+            }
+        }
+        else if (strcmp(*argv, "-i") == 0 && argc > 1)
+        {
+            ++argv;
+            --argc;
+            variants = atoi(*argv);
+            if (variants < 0)
+            {
+                fprintf(stderr, "bank: The number of variants must be at least 0.\n");
+                return 1;
+            }
+        }
+        else
+        {
+            fprintf(stderr, "Invalid parameter '%s'\n", *argv);
+            syntax();
+            return 1;
+        }
+
+        ++argv;
+        --argc;
+    }
+
+    if (argc != 1)
+    {
+        syntax();
+        return 1;
+    }
+    char const * path = *argv;
+
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point deadline = Clock::now() + std::chrono::milliseconds((long long)(timeLimit * 1000.0f));
+
+    // Each thread searches for a puzzle of a difficulty that is still needed, and adds it and its variants to the collection
+    Collection collection(count);
+    auto       work = [&collection, variants, deadline] () {
+        std::mt19937 rng(std::random_device{}());
+        while (Clock::now() < deadline)
+        {
+            int d = collection.choose(rng);
+            if (d == 0)
+                break;
+
+            auto  limit  = std::min(std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()),
+                                    std::chrono::milliseconds(SEARCH_TIME_LIMIT * 1000));
+            // Search for puzzles that round to d (or above, for the highest difficulty). The maximum passed to search() is 1 less
+            // than the end of the range.
+            float target  = (float)d;
+            float maximum = (d == PuzzleBank::MAX_DIFFICULTY) ? target : target - 0.5f;
+            Board board;
+            Generator::search(maximum, target - 0.5f, limit, board);
+
+            Board variant = board;
+            for (int v = 0; v <= variants; ++v)
+            {
+                Generator::TechniqueSet techniques;
+                float                   rating = Generator::computeDifficulty(variant, &techniques);
+                collection.add(variant, rating, techniques);
+                variant = Generator::isomorph(board);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    int                      n = std::max(1, (int)std::thread::hardware_concurrency());
+    for (int i = 0; i < n; ++i)
+    {
+        threads.emplace_back(work);
+    }
+    for (auto & t : threads)
+    {
+        t.join();
+    }
+
+    if (!PuzzleBank::write(path, collection.entries()))
+    {
+        fprintf(stderr, "bank: Unable to write '%s'.\n", path);
+        return 2;
+    }
+
+    for (int d = 1; d <= PuzzleBank::MAX_DIFFICULTY; ++d)
+    {
+        printf("%d: %d\n", d, collection.sizes()[d - 1]);
+    }
+
+    return 0;
+}
@@ -1,13 +1,172 @@
+#include "Analyzer/Analyzer.h"
 #include "Board/Board.h"
 #include "Generator/Generator.h"
 #include "Solver/Solver.h"
 
+#include <nlohmann/json.hpp>
+
+#include <cctype>
+#include <chrono>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+
+static int constexpr DEFAULT_TECHNIQUE_TIME_LIMIT = 60; // Default time limit in seconds when techniques are specified
+static int constexpr DEFAULT_CLUES_TIME_LIMIT     = 60; // Default time limit in seconds when a number of clues is specified
+static int constexpr DEFAULT_PATTERN_TIME_LIMIT   = 60; // Default time limit in seconds when a pattern is specified
+static int constexpr CHECKPOINT_INTERVAL          = 60; // Minimum time in seconds between checkpoints
+static int constexpr CHECKPOINT_VERSION           = 1;  // Version of the checkpoint file format
 
 static void syntax()
 {
-    fprintf(stderr, "syntax: generate [max difficulty] [min difficulty]\n");
+    fprintf(stderr, "syntax: generate [-n <count>] [-t <seconds>] [-r <techniques>] [-x <techniques>] [max difficulty] [min difficulty]\n");
+    fprintf(stderr, "       generate [-n <count>] -m [max difficulty] [min difficulty]\n");
+    fprintf(stderr, "       generate [-n <count>] -g <solution> [max difficulty] [min difficulty]\n");
+    fprintf(stderr, "       generate [-n <count>] [-t <seconds>] -c <clues>\n");
+    fprintf(stderr, "       generate [-n <count>] [-t <seconds>] -p <pattern>\n");
+    fprintf(stderr, "       generate [-n <count>] -i <puzzle>\n");
+    fprintf(stderr, "Any of the above can be preceded by [-v] [-k <file> [-R]].\n");
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -n <count>:       generates this many puzzles (default: 1)\n");
+    fprintf(stderr, "  -i <puzzle>:      generates random puzzles equivalent to the given puzzle, without solving or rating\n");
+    fprintf(stderr, "  -g <solution>:    generates different puzzles from this solved board\n");
+    fprintf(stderr, "  -m:               generates minimal puzzles (no clue can be removed)\n");
+    fprintf(stderr, "  -c <clues>:       searches for minimal puzzles with at most this many clues\n");
+    fprintf(stderr, "  -p <pattern>:     generates puzzles with clues exactly where the pattern has them (81 squares, '.', ' ', or '0' if empty)\n");
+    fprintf(stderr, "  -t <seconds>:     searches for a puzzle in the difficulty range for at most this long\n");
+    fprintf(stderr, "  -r <techniques>:  the solution must use these techniques (comma-separated, e.g. X_CYCLE,XY_WING)\n");
+    fprintf(stderr, "  -x <techniques>:  the solution must not use these techniques\n");
+    fprintf(stderr, "  -v:               outputs generator statistics when done\n");
+    fprintf(stderr, "  -k <file>:        periodically saves progress to this checkpoint file\n");
+    fprintf(stderr, "  -R:               resumes from the checkpoint file, first outputting the puzzles already generated\n");
+}
+
+// Outputs the generator's statistics
+static void printStats(Generator::Stats const & stats)
+{
+    fprintf(stderr, "solved boards = %llu\n", (unsigned long long)stats.solvedBoards);
+    fprintf(stderr, "removals attempted = %llu\n", (unsigned long long)stats.removals);
+    fprintf(stderr, "removals rejected (not unique) = %llu\n", (unsigned long long)stats.notUnique);
+    fprintf(stderr, "removals rejected (too difficult) = %llu\n", (unsigned long long)stats.tooDifficult);
+    fprintf(stderr, "boards discarded (too easy) = %llu\n", (unsigned long long)stats.tooEasy);
+    fprintf(stderr,
+            "uniqueness checks searched = %llu, skipped = %llu, cached = %llu\n",
+            (unsigned long long)stats.uniquenessSearches,
+            (unsigned long long)stats.uniquenessSkipped,
+            (unsigned long long)stats.uniquenessCached);
+    fprintf(stderr, "uniqueness time = %g s\n", std::chrono::duration<double>(stats.uniquenessTime).count());
+    fprintf(stderr, "difficulty time = %g s\n", std::chrono::duration<double>(stats.difficultyTime).count());
+}
+
+// Saves the progress of a run. The new file is written under a temporary name and then renamed over the old one, which replaces it
+// atomically on POSIX systems, so there is always a complete checkpoint.
+static bool writeCheckpoint(char const * path, std::string const & options, std::vector<std::string> const & completed)
+{
+    json checkpoint =
+    {
+        { "version", CHECKPOINT_VERSION },
+        { "options", options },
+        { "random", Generator::randomState() },
+        { "completed", completed }
+    };
+
+    std::string temporary = std::string(path) + ".tmp";
+    {
+        std::ofstream file(temporary);
+        file << checkpoint.dump(2) << std::endl;
+        if (!file)
+            return false;
+    }
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    return !error;
+}
+
+// Restores the progress of a run. Returns false if the file cannot be read or was saved by a run with different options.
+static bool readCheckpoint(char const * path, std::string const & options, std::vector<std::string> & completed)
+{
+    json          checkpoint;
+    std::ifstream file(path);
+    if (!file)
+    {
+        fprintf(stderr, "generate: Unable to open checkpoint '%s'.\n", path);
+        return false;
+    }
+    try
+    {
+        file >> checkpoint;
+        if (checkpoint.at("version").get<int>() != CHECKPOINT_VERSION)
+        {
+            fprintf(stderr, "generate: Checkpoint '%s' has an unsupported version.\n", path);
+            return false;
+        }
+        if (checkpoint.at("options").get<std::string>() != options)
+        {
+            fprintf(stderr, "generate: Checkpoint '%s' was saved with different options.\n", path);
+            return false;
+        }
+        completed = checkpoint.at("completed").get<std::vector<std::string>>();
+        if (!Generator::setRandomState(checkpoint.at("random").get<std::string>()))
+        {
+            fprintf(stderr, "generate: Checkpoint '%s' is invalid.\n", path);
+            return false;
+        }
+    }
+    catch (json::exception const &)
+    {
+        fprintf(stderr, "generate: Checkpoint '%s' is invalid.\n", path);
+        return false;
+    }
+    return true;
+}
+
+// Returns a technique name in lower case with '_' and '-' replaced by spaces, so that "X_CYCLE" matches "x-cycle"
+static std::string normalizedTechniqueName(std::string const & name)
+{
+    std::string normalized;
+    for (char c : name)
+    {
+        normalized.push_back((c == '_' || c == '-') ? ' ' : (char)tolower((unsigned char)c));
+    }
+    return normalized;
+}
+
+// Parses a comma-separated list of technique names. Returns false if a name is not recognized.
+static bool parseTechniques(char const * list, Generator::TechniqueSet & techniques)
+{
+    std::string names(list);
+    size_t      start = 0;
+    while (start <= names.size())
+    {
+        size_t end = names.find(',', start);
+        if (end == std::string::npos)
+            end = names.size();
+        std::string name  = normalizedTechniqueName(names.substr(start, end - start));
+        bool        found = false;
+        for (int t = Analyzer::Step::NONE + 1; t < Analyzer::Step::NUMBER_OF_TECHNIQUES; ++t)
+        {
+            if (name == normalizedTechniqueName(Analyzer::Step::techniqueName(Analyzer::Step::TechniqueId(t))))
+            {
+                techniques |= Generator::TechniqueSet(1) << t;
+                found       = true;
+                break;
+            }
+        }
+        if (!found)
+        {
+            fprintf(stderr, "generate: Unknown technique '%s'.\n", names.substr(start, end - start).c_str());
+            return false;
+        }
+        start = end + 1;
+    }
+    return true;
 }
 
 int main(int argc, char ** argv)
@@ -15,6 +174,189 @@ int main(int argc, char ** argv)
     --argc;
     ++argv;
 
+    int                     count      = 1;
+    float                   timeLimit  = 0.0f;
+    Generator::TechniqueSet required   = 0;
+    Generator::TechniqueSet forbidden  = 0;
+    char const *            seedPuzzle = nullptr;
+    bool                    minimal    = false;
+    int                     maxClues   = 0;
+    char const *            pattern    = nullptr;
+    char const *            solution   = nullptr;
+    char const *            checkpoint = nullptr;
+    bool                    resume     = false;
+    bool                    verbose    = false;
+
+    // The options of a resumed run must match the ones saved in its checkpoint
+    std::string options;
+    for (int a = 0; a < argc; ++a)
+    {
+        if (strcmp(argv[a], "-k") == 0 && a + 1 < argc)
+        {
+            ++a;
+            continue;
+        }
+        if (strcmp(argv[a], "-R") == 0 || strcmp(argv[a], "-v") == 0)
+            continue;
+        if (!options.empty())
+            options += ' ';
+        options += argv[a];
+    }
+
+    while (argc > 0 && **argv == '-')
+    {
+        if (strcmp(*argv, "-k") == 0 && argc > 1)
+        {
+            ++argv;
+            --argc;
+            checkpoint = *argv;
+        }
+        else if (strcmp(*argv, "-R") == 0)
+        {
+            resume = true;
+        }
+        else if (strcmp(*argv, "-v") == 0)
+        {
+            verbose = true;
+        }
+        else if (strcmp(*argv, "-n") == 0 && argc > 1)
+        {
+            ++argv;
+            --argc;
+            count = atoi(*argv);
+            if (count <= 0)
+            {
+                fprintf(stderr, "generate: The count must be greater than 0.\n");
+                return 1;
+            }
+        }
+        else if (strcmp(*argv, "-i") == 0 && argc > 1)
+        {
+            ++argv;
+            --argc;
+            seedPuzzle = *argv;
+        }
+        else if (strcmp(*argv, "-m") == 0)
+        {
+            minimal = true;
+        }
+        else if (strcmp(*argv, "-c") == 0 && argc > 1)
+        {
+            ++argv;
+            --argc;
+            maxClues = atoi(*argv);
+            if (maxClues < 17 || maxClues > Board::NUM_CELLS)
+            {
+                fprintf(stderr, "generate: The number of clues must be from 17 to %d.\n", Board::NUM_CELLS);
+                return 1;
+            }
+        }
+        else if (strcmp(*argv, "-g") == 0 && argc > 1)
+        {
+            ++argv;
+            --argc;
+            solution = *argv;
+        }
+        else if (strcmp(*argv, "-p") == 0 && argc > 1)
+        {
+            ++argv;
+            --argc;
+            pattern = *argv;
+        }
+        else if (strcmp(*argv, "-t") == 0 && argc > 1)
+        {
+            ++argv;
+            --argc;
+            (void)sscanf(*argv, "%f", &timeLimit);
+            if (timeLimit <= 0.0f)
+            {
+                fprintf(stderr, "generate: The time limit must be greater than 0.\n");
+                return 1;
+            }
+        }
+        else if (strcmp(*argv, "-r") == 0 && argc > 1)
+        {
+            ++argv;
+            --argc;
+            if (!parseTechniques(*argv, required))
+                return 1;
+        }
+        else if (strcmp(*argv, "-x") == 0 && argc > 1)
+        {
+            ++argv;
+            --argc;
+            if (!parseTechniques(*argv, forbidden))
+                return 1;
+        }
+        else
+        {
+            fprintf(stderr, "Invalid parameter '%s'\n", *argv);
+            syntax();
+            return 1;
+        }
+
+        ++argv;
+        --argc;
+    }
+
+    Board seedBoard;
+    if (seedPuzzle)
+    {
+        // Remove the "SD" prefix if present
+        if (seedPuzzle[0] == 'S' && seedPuzzle[1] == 'D')
+            seedPuzzle += 2;
+        if (strlen(seedPuzzle) != Board::NUM_CELLS || !seedBoard.initialize(seedPuzzle) || !seedBoard.consistent())
+        {
+            fprintf(stderr, "generate: The puzzle must be 81 consistent squares ('.', ' ', '0', or '1'-'9').\n");
+            return 1;
+        }
+        if (argc != 0 || timeLimit > 0.0f || required != 0 || forbidden != 0 || minimal || maxClues > 0)
+        {
+            fprintf(stderr, "generate: No other options or parameters can be specified with -i.\n");
+            return 1;
+        }
+    }
+
+    Board solutionBoard;
+    if (solution)
+    {
+        // Remove the "SD" prefix if present
+        if (solution[0] == 'S' && solution[1] == 'D')
+            solution += 2;
+        if (strlen(solution) != Board::NUM_CELLS || !solutionBoard.initialize(solution) || !solutionBoard.solved())
+        {
+            fprintf(stderr, "generate: The solution must be 81 squares ('1'-'9') forming a solved board.\n");
+            return 1;
+        }
+        if (timeLimit > 0.0f || required != 0 || forbidden != 0 || minimal || maxClues > 0 || seedPuzzle)
+        {
+            fprintf(stderr, "generate: Only -n and difficulties can be specified with -g.\n");
+            return 1;
+        }
+    }
+
+    Generator::Pattern clueCells;
+    if (pattern)
+    {
+        if (strlen(pattern) != Board::NUM_CELLS)
+        {
+            fprintf(stderr, "generate: The pattern must be 81 squares ('.', ' ', or '0' if empty).\n");
+            return 1;
+        }
+        for (int i = 0; i < Board::NUM_CELLS; ++i)
+        {
+            clueCells[i] = pattern[i] != '.' && pattern[i] != ' ' && pattern[i] != '0';
+        }
+        if (argc != 0 || required != 0 || forbidden != 0 || minimal || maxClues > 0 || seedPuzzle || solution)
+        {
+            fprintf(stderr, "generate: Only -n and -t can be specified with -p.\n");
+            return 1;
+        }
+    }
+
+    // Without difficulties, one of the other modes must be specified
+    bool anyMode = required != 0 || forbidden != 0 || seedPuzzle || minimal || maxClues > 0 || pattern || solution;
+
     float minDifficulty = 0.0f;
     float maxDifficulty = 0.0f;
 
@@ -44,18 +386,176 @@ int main(int argc, char ** argv)
             return 1;
         }
     }
-    else
+    else if (argc != 0 || (timeLimit <= 0.0f && !anyMode))
     {
         syntax();
         return 1;
     }
 
-    srand((unsigned int)time(NULL));
+    if ((required & forbidden) != 0)
+    {
+        fprintf(stderr, "generate: A technique cannot be both required and forbidden.\n");
+        return 1;
+    }
 
-    Board       board = Generator::generate(maxDifficulty, minDifficulty);
-    std::string serialized;
-    board.serialize(serialized);
-    puts(serialized.c_str());
+    if ((required != 0 || forbidden != 0) && argc != 0)
+    {
+        fprintf(stderr, "generate: Difficulties cannot be specified with techniques.\n");
+        return 1;
+    }
+
+    if ((minimal || maxClues > 0) && (required != 0 || forbidden != 0))
+    {
+        fprintf(stderr, "generate: Techniques cannot be specified with -m or -c.\n");
+        return 1;
+    }
+
+    if (minimal && timeLimit > 0.0f)
+    {
+        fprintf(stderr, "generate: A time limit cannot be specified with -m.\n");
+        return 1;
+    }
+
+    if (maxClues > 0 && (argc != 0 || minimal))
+    {
+        fprintf(stderr, "generate: Difficulties and -m cannot be specified with -c.\n");
+        return 1;
+    }
+
+    if (resume && !checkpoint)
+    {
+        fprintf(stderr, "generate: -R requires a checkpoint file (-k).\n");
+        return 1;
+    }
+
+    if (checkpoint && (solution || pattern))
+    {
+        fprintf(stderr, "generate: A checkpoint cannot be saved with -g or -p.\n");
+        return 1;
+    }
+
+    Generator::seed((unsigned int)time(NULL));
+
+    if (solution)
+    {
+        std::vector<Board> boards = Generator::generateFromSolution(solutionBoard, count, maxDifficulty, minDifficulty);
+        for (auto const & board : boards)
+        {
+            std::string serialized;
+            board.serialize(serialized);
+            puts(serialized.c_str());
+        }
+        if ((int)boards.size() < count)
+        {
+            fprintf(stderr, "generate: Only %d different puzzles were found for the solution.\n", (int)boards.size());
+            if (verbose)
+                printStats(Generator::stats());
+            return 5;
+        }
+        if (verbose)
+            printStats(Generator::stats());
+        return 0;
+    }
+
+    // Output the puzzles completed before the checkpoint, and continue with the random state that followed them. A puzzle that was
+    // in progress is generated again, unless its search has a time limit, in which case the result depends on the timing as well.
+    std::vector<std::string> completed;
+    if (resume)
+    {
+        if (!readCheckpoint(checkpoint, options, completed))
+            return 6;
+        for (auto const & serialized : completed)
+        {
+            puts(serialized.c_str());
+        }
+    }
+
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point lastCheckpoint = Clock::now();
+    for (int n = (int)completed.size(); n < count; ++n)
+    {
+        Board board;
+        if (seedPuzzle)
+        {
+            board = Generator::isomorph(seedBoard);
+        }
+        else if (pattern)
+        {
+            if (timeLimit <= 0.0f)
+                timeLimit = (float)DEFAULT_PATTERN_TIME_LIMIT;
+            auto limit = std::chrono::milliseconds((long long)(timeLimit * 1000.0f));
+            if (!Generator::generateWithPattern(clueCells, limit, board))
+            {
+                fprintf(stderr, "generate: No puzzle with the pattern was found within the time limit.\n");
+                if (verbose)
+                    printStats(Generator::stats());
+                return 5;
+            }
+        }
+        else if (maxClues > 0)
+        {
+            if (timeLimit <= 0.0f)
+                timeLimit = (float)DEFAULT_CLUES_TIME_LIMIT;
+            auto limit = std::chrono::milliseconds((long long)(timeLimit * 1000.0f));
+            if (!Generator::searchMinimal(maxClues, limit, board))
+            {
+                fprintf(stderr, "generate: No minimal puzzle with at most %d clues was found within the time limit.\n", maxClues);
+                if (verbose)
+                    printStats(Generator::stats());
+                return 5;
+            }
+        }
+        else if (minimal)
+        {
+            board = Generator::generateMinimal(maxDifficulty, minDifficulty);
+        }
+        else if (required != 0 || forbidden != 0)
+        {
+            if (timeLimit <= 0.0f)
+                timeLimit = (float)DEFAULT_TECHNIQUE_TIME_LIMIT;
+            auto limit = std::chrono::milliseconds((long long)(timeLimit * 1000.0f));
+            if (!Generator::generateWithTechniques(required, forbidden, limit, board))
+            {
+                fprintf(stderr, "generate: No puzzle with the required techniques was found within the time limit.\n");
+                if (verbose)
+                    printStats(Generator::stats());
+                return 5;
+            }
+        }
+        else if (timeLimit > 0.0f)
+        {
+            auto limit = std::chrono::milliseconds((long long)(timeLimit * 1000.0f));
+            if (!Generator::search(maxDifficulty, minDifficulty, limit, board))
+            {
+                fprintf(stderr, "generate: No puzzle in the difficulty range was found within the time limit.\n");
+                if (verbose)
+                    printStats(Generator::stats());
+                return 5;
+            }
+        }
+        else
+        {
+            board = Generator::generate(maxDifficulty, minDifficulty);
+        }
+
+        std::string serialized;
+        board.serialize(serialized);
+        puts(serialized.c_str());
+
+        if (checkpoint)
+        {
+            completed.push_back(serialized);
+            if (n == count - 1 || Clock::now() - lastCheckpoint >= std::chrono::seconds(CHECKPOINT_INTERVAL))
+            {
+                fflush(stdout);
+                if (!writeCheckpoint(checkpoint, options, completed))
+                    fprintf(stderr, "generate: Unable to write checkpoint '%s'.\n", checkpoint);
+                lastCheckpoint = Clock::now();
+            }
+        }
+    }
 
+    if (verbose)
+        printStats(Generator::stats());
     return 0;
 }
@@ -1,14 +1,29 @@
+#include "Analyzer/Analyzer.h"
+#include "Analyzer/Candidates.h"
+#include "Analyzer/LinkGraph.h"
+#include "Analyzer/XCycle.h"
 #include "Board/Board.h"
 #include "Generator/Generator.h"
 #include "Solver/Solver.h"
 
+#include <chrono>
 #include <cstdio>
+#include <cstring>
 #include <ctime>
+#include <string>
+#include <vector>
 
 static int constexpr DEFAULT_NUMBER_OF_BOARDS = 1000;
+static int constexpr SOLVED_BOARDS_PER_BOARD  = 1000; // Solved boards are much faster to make, so many more are profiled
+static double constexpr MIN_X_CYCLE_TIME      = 1.0;  // X-cycle searches are repeated for at least this many seconds
 
+static bool s_verbose = false;
+
+static void ProfileGenerateSolvedBoards(int count);
 static void ProfileGenerate(int count, std::vector<Board> & boards);
+static void ProfileXCycle(std::vector<Board> const & boards);
 static void ProfileSolve(std::vector<Board> & boards);
+static void printStats(Generator::Stats const & stats);
 
 int main(int argc, char ** argv)
 {
@@ -16,9 +31,16 @@ int main(int argc, char ** argv)
 
     --argc;
     ++argv;
+    if (argc > 0 && strcmp(*argv, "-v") == 0)
+    {
+        s_verbose = true;
+        --argc;
+        ++argv;
+    }
+
     if (argc > 1)
     {
-        fprintf(stderr, "syntax: profile [count]\n");
+        fprintf(stderr, "syntax: profile [-v] [count]\n");
         return 1;
     }
 
@@ -28,27 +50,44 @@ int main(int argc, char ** argv)
         if (count <= 0)
         {
             fprintf(stderr, "'%s' is an invalid count.\n", *argv);
-            fprintf(stderr, "syntax: profile [count]\n");
+            fprintf(stderr, "syntax: profile [-v] [count]\n");
             return 1;
         }
         --argc;
         ++argv;
     }
 
-    srand((unsigned)time(NULL));
+    Generator::seed((unsigned)time(NULL));
     std::vector<Board> boards;
     boards.reserve(count);
 
+    ProfileGenerateSolvedBoards(count * SOLVED_BOARDS_PER_BOARD);
     ProfileGenerate(count, boards);
+    ProfileXCycle(boards);
     ProfileSolve(boards);
 
     return 0;
 }
 
+static void ProfileGenerateSolvedBoards(int count)
+{
+    printf("Profiling Generator::generateSolvedBoards ...\n");
+
+    auto               start_time = std::chrono::steady_clock::now();
+    std::vector<Board> solved     = Generator::generateSolvedBoards(count);
+    auto               end_time   = std::chrono::steady_clock::now();
+
+    double total_time = std::chrono::duration<double>(end_time - start_time).count();
+    printf("%d boards\n", (int)solved.size());
+    printf("total time = %g s\n", total_time);
+    printf("rate = %g boards/s\n\n", (double)solved.size() / total_time);
+}
+
 static void ProfileGenerate(int count, std::vector<Board> & boards)
 {
     printf("Profiling Generator::generate ...\n");
 
+    Generator::resetStats();
     time_t start_time = time(NULL);
     for (int i = 0; i < count; ++i)
     {
@@ -59,7 +98,73 @@ static void ProfileGenerate(int count, std::vector<Board> & boards)
     int total_time = int(end_time - start_time);
     printf("%d boards\n", count);
     printf("total time = %d s\n", total_time);
-    printf("average time = %g ms\n\n", float(total_time) / (float)count * 1000.0f);
+    printf("average time = %g ms\n", float(total_time) / (float)count * 1000.0f);
+    if (s_verbose)
+        printStats(Generator::stats());
+    printf("\n");
+}
+
+static void ProfileXCycle(std::vector<Board> const & boards)
+{
+    printf("Profiling XCycle::exists ...\n");
+
+    // Collect the positions in which the analyzer searches for an x-cycle, which are those in which it finds one, finds a step with
+    // a technique that is tried later, or gets stuck
+    int xCycleDifficulty = Analyzer::Step::techniqueDifficulty(Analyzer::Step::X_CYCLE);
+    std::vector<Candidates::List> positions;
+    for (auto const & b : boards)
+    {
+        Analyzer analyzer(b);
+        while (!analyzer.done())
+        {
+            Candidates::List candidates = analyzer.candidates();
+            Analyzer::Step   step       = analyzer.next();
+            int  difficulty = Analyzer::Step::techniqueDifficulty(step.technique);
+            bool later      = difficulty > xCycleDifficulty ||
+                              (difficulty == xCycleDifficulty && step.technique >= Analyzer::Step::X_CYCLE);
+            if (later || step.action == Analyzer::Step::STUCK)
+                positions.push_back(candidates);
+        }
+    }
+    if (positions.empty())
+    {
+        printf("no positions\n\n");
+        return;
+    }
+
+    std::vector<LinkGraph> graphs;
+    graphs.reserve(positions.size());
+    for (auto const & candidates : positions)
+    {
+        graphs.emplace_back(candidates);
+    }
+
+    // Search every position repeatedly until enough time has passed to get a stable average
+    int    searches = 0;
+    int    found    = 0;
+    double total_time;
+    auto   start_time = std::chrono::steady_clock::now();
+    do
+    {
+        found = 0;
+        for (size_t k = 0; k < positions.size(); ++k)
+        {
+            XCycle           xcycle(positions[k], graphs[k]);
+            std::vector<int> indexes;
+            std::vector<int> values;
+            std::string      reason;
+            bool             solves;
+            if (xcycle.exists(indexes, values, reason, solves))
+                ++found;
+        }
+        searches  += (int)positions.size();
+        total_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    } while (total_time < MIN_X_CYCLE_TIME);
+
+    printf("%d positions, %d with an x-cycle\n", (int)positions.size(), found);
+    printf("%d searches\n", searches);
+    printf("total time = %g s\n", total_time);
+    printf("average time = %g us\n\n", total_time / (double)searches * 1000000.0);
 }
 
 static void ProfileSolve(std::vector<Board> & boards)
@@ -77,3 +182,18 @@ static void ProfileSolve(std::vector<Board> & boards)
     printf("total time = %d s\n", total_time);
     printf("average time = %g ms\n\n", float(total_time) / (float)boards.size() * 1000.0f);
 }
+
+static void printStats(Generator::Stats const & stats)
+{
+    printf("solved boards = %llu\n", (unsigned long long)stats.solvedBoards);
+    printf("removals attempted = %llu\n", (unsigned long long)stats.removals);
+    printf("removals rejected (not unique) = %llu\n", (unsigned long long)stats.notUnique);
+    printf("removals rejected (too difficult) = %llu\n", (unsigned long long)stats.tooDifficult);
+    printf("boards discarded (too easy) = %llu\n", (unsigned long long)stats.tooEasy);
+    printf("uniqueness checks searched = %llu, skipped = %llu, cached = %llu\n",
+           (unsigned long long)stats.uniquenessSearches,
+           (unsigned long long)stats.uniquenessSkipped,
+           (unsigned long long)stats.uniquenessCached);
+    printf("uniqueness time = %g s\n", std::chrono::duration<double>(stats.uniquenessTime).count());
+    printf("difficulty time = %g s\n", std::chrono::duration<double>(stats.difficultyTime).count());
+}
@@ -3,6 +3,7 @@
 #include "Solver/Solver.h"
 
 #include <cstdio>
+#include <cstring>
 #include <ctime>
 
 static void syntax()
@@ -0,0 +1,54 @@
+#include "Analyzer/AIC.h"
+
+#include "Analyzer/Candidates.h"
+#include "Analyzer/LinkGraph.h"
+#include "Board/Board.h"
+
+#include <gtest/gtest.h>
+
+TEST(AIC, exists)
+{
+    std::vector<int> indexes;
+    std::vector<int> values;
+    std::string      reason;
+
+    // No chains
+    Candidates::List all(Board::NUM_CELLS, Candidates::ALL);
+    LinkGraph        allLinks(all);
+    EXPECT_FALSE(AIC(all, allLinks).exists(indexes, values, reason));
+
+    // An xy-chain: If A1 is not 1, then it is 2, so A5 is 3, so E5 is 1. Either way, E1 cannot be 1.
+    Candidates::List candidates(Board::NUM_CELLS, Candidates::ALL);
+    candidates[0]  = Candidates::fromValue(1) | Candidates::fromValue(2);
+    candidates[4]  = Candidates::fromValue(2) | Candidates::fromValue(3);
+    candidates[40] = Candidates::fromValue(3) | Candidates::fromValue(1);
+    LinkGraph links(candidates);
+    ASSERT_TRUE(AIC(candidates, links).exists(indexes, values, reason));
+    EXPECT_EQ(indexes, std::vector<int>({ 36 }));
+    EXPECT_EQ(values, std::vector<int>({ 1 }));
+    EXPECT_FALSE(reason.empty());
+
+    // An x-chain: 1 can only be in A1 and A5 in row A, and in E2 and E5 in row E. If A1 is not 1, then A5 is 1, so E5 is not 1, so
+    // E2 is 1. Either way, B2, C2, D1 and F1 cannot be 1.
+    Candidates::List conjugates(Board::NUM_CELLS, Candidates::ALL);
+    for (int c = 0; c < Board::SIZE; ++c)
+    {
+        if (c != 0 && c != 4)
+            conjugates[Board::Cell::indexOf(0, c)] &= ~Candidates::fromValue(1);
+        if (c != 1 && c != 4)
+            conjugates[Board::Cell::indexOf(4, c)] &= ~Candidates::fromValue(1);
+    }
+    LinkGraph conjugateLinks(conjugates);
+    indexes.clear();
+    values.clear();
+    ASSERT_TRUE(AIC(conjugates, conjugateLinks).exists(indexes, values, reason));
+    EXPECT_EQ(indexes, std::vector<int>({ 10, 19, 27, 45 }));
+    EXPECT_EQ(values, std::vector<int>({ 1 }));
+}
+
+int main(int argc, char ** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    int rv = RUN_ALL_TESTS();
+    return rv;
+}
@@ -0,0 +1,49 @@
+#include "Analyzer/ALSXYWing.h"
+
+#include "Analyzer/AlmostLockedSets.h"
+#include "Analyzer/Candidates.h"
+#include "Analyzer/LinkGraph.h"
+#include "Board/Board.h"
+
+#include <gtest/gtest.h>
+
+TEST(ALSXYWing, exists)
+{
+    std::vector<int> indexes;
+    std::vector<int> values;
+    std::string      reason;
+
+    // No sets
+    Candidates::List all(Board::NUM_CELLS, Candidates::ALL);
+    LinkGraph        allLinks(all);
+    AlmostLockedSets none(all, allLinks);
+    EXPECT_FALSE(ALSXYWing(none).exists(indexes, values, reason));
+
+    // A1 is 1 or 2, A5 is 1 or 3, and E1 is 2 or 3. A1 is linked to A5 by 1 and to E1 by 2, so either A5 or E1 is 3 and E5 cannot
+    // be 3.
+    Candidates::List candidates(Board::NUM_CELLS, Candidates::ALL);
+    candidates[0]  = Candidates::fromValue(1) | Candidates::fromValue(2);
+    candidates[4]  = Candidates::fromValue(1) | Candidates::fromValue(3);
+    candidates[36] = Candidates::fromValue(2) | Candidates::fromValue(3);
+    LinkGraph        links(candidates);
+    AlmostLockedSets als(candidates, links);
+    ASSERT_TRUE(ALSXYWing(als).exists(indexes, values, reason));
+    EXPECT_EQ(indexes, std::vector<int>({ 40 }));
+    EXPECT_EQ(values, std::vector<int>({ 3 }));
+    EXPECT_FALSE(reason.empty());
+
+    // If E1 is 2 or 4 instead, there is no common value to eliminate
+    candidates[36] = Candidates::fromValue(2) | Candidates::fromValue(4);
+    LinkGraph        unlinked(candidates);
+    AlmostLockedSets other(candidates, unlinked);
+    indexes.clear();
+    values.clear();
+    EXPECT_FALSE(ALSXYWing(other).exists(indexes, values, reason));
+}
+
+int main(int argc, char ** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    int rv = RUN_ALL_TESTS();
+    return rv;
+}
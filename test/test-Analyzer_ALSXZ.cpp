@@ -0,0 +1,44 @@
+#include "Analyzer/ALSXZ.h"
+
+#include "Analyzer/AlmostLockedSets.h"
+#include "Analyzer/Candidates.h"
+#include "Analyzer/LinkGraph.h"
+#include "Board/Board.h"
+
+#include <gtest/gtest.h>
+
+TEST(ALSXZ, exists)
+{
+    std::vector<int> indexes;
+    std::vector<int> values;
+    std::string      reason;
+
+    // No sets
+    Candidates::List all(Board::NUM_CELLS, Candidates::ALL);
+    LinkGraph        allLinks(all);
+    AlmostLockedSets none(all, allLinks);
+    EXPECT_FALSE(ALSXZ(none).exists(indexes, values, reason));
+
+    // A1 is 1 or 2, and A5 and B5 in column 5 can only be 1, 2 or 3. A1 and A5 cannot both be 1, so either A1 is 2, or A1 is 1,
+    // so A5 is 3 and B5 is 2. Therefore A4, A6, B1, B2 and B3 cannot be 2.
+    Candidates::List candidates(Board::NUM_CELLS, Candidates::ALL);
+    candidates[0]  = Candidates::fromValue(1) | Candidates::fromValue(2);
+    candidates[4]  = Candidates::fromValue(1) | Candidates::fromValue(3);
+    candidates[13] = Candidates::fromValue(2) | Candidates::fromValue(3);
+    LinkGraph        links(candidates);
+    AlmostLockedSets als(candidates, links);
+    ASSERT_TRUE(ALSXZ(als).exists(indexes, values, reason));
+    EXPECT_EQ(indexes, std::vector<int>({ 3, 5, 9, 10, 11 }));
+    EXPECT_EQ(values, std::vector<int>({ 2 }));
+    EXPECT_EQ(reason,
+              "Squares A1 in row A, which can only be 1 or 2, and squares A5 and B5 in column 5, which can only be 1, 2 or 3. "
+              "Only one of these sets can have the value 1, so the other must have all of its other values, and so one of them must "
+              "have the value 2. Either way, A4 A6 B1 B2 B3 cannot be 2.");
+}
+
+int main(int argc, char ** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    int rv = RUN_ALL_TESTS();
+    return rv;
+}
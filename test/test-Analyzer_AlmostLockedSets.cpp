@@ -0,0 +1,49 @@
+#include "Analyzer/AlmostLockedSets.h"
+
+#include "Analyzer/Candidates.h"
+#include "Analyzer/LinkGraph.h"
+#include "Analyzer/Positions.h"
+#include "Board/Board.h"
+
+#include <gtest/gtest.h>
+
+TEST(AlmostLockedSets, sets)
+{
+    // No sets when every value is possible in every cell
+    Candidates::List all(Board::NUM_CELLS, Candidates::ALL);
+    LinkGraph        allLinks(all);
+    EXPECT_TRUE(AlmostLockedSets(all, allLinks).sets().empty());
+
+    // A1 is 1 or 2, and A5 and B5 are 1 or 3 and 2 or 3. Each set is found only once.
+    Candidates::List candidates(Board::NUM_CELLS, Candidates::ALL);
+    candidates[0]  = Candidates::fromValue(1) | Candidates::fromValue(2);
+    candidates[4]  = Candidates::fromValue(1) | Candidates::fromValue(3);
+    candidates[13] = Candidates::fromValue(2) | Candidates::fromValue(3);
+    LinkGraph        links(candidates);
+    AlmostLockedSets als(candidates, links);
+    std::vector<AlmostLockedSets::Set> const & sets = als.sets();
+    ASSERT_EQ(sets.size(), 5);
+    EXPECT_EQ(sets[0].cells.indexes(), std::vector<int>({ 0 }));
+    EXPECT_EQ(sets[1].cells.indexes(), std::vector<int>({ 4 }));
+    EXPECT_EQ(sets[2].cells.indexes(), std::vector<int>({ 0, 4 }));
+    EXPECT_EQ(sets[3].cells.indexes(), std::vector<int>({ 13 }));
+    EXPECT_EQ(sets[4].cells.indexes(), std::vector<int>({ 4, 13 }));
+    EXPECT_EQ(sets[4].group, Positions::column(4));
+    EXPECT_EQ(sets[4].values, Candidates::fromValue(1) | Candidates::fromValue(2) | Candidates::fromValue(3));
+    EXPECT_EQ(AlmostLockedSets::describe(sets[2]), "A1 and A5 in row A, which can only be 1, 2 or 3");
+
+    // 1 is a restricted common candidate of A1 and A5, since they see each other, but 2 is not one of A1 and B5
+    EXPECT_TRUE(AlmostLockedSets::isRestrictedCommon(sets[0], sets[1], 1));
+    EXPECT_FALSE(AlmostLockedSets::isRestrictedCommon(sets[0], sets[1], 2));
+    EXPECT_FALSE(AlmostLockedSets::isRestrictedCommon(sets[0], sets[3], 2));
+
+    // A4, A6, B1, B2 and B3 see both A1 and B5
+    EXPECT_EQ(als.seenByBoth(sets[0], sets[3], 2).indexes(), std::vector<int>({ 3, 5, 9, 10, 11 }));
+}
+
+int main(int argc, char ** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    int rv = RUN_ALL_TESTS();
+    return rv;
+}
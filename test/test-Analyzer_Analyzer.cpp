@@ -13,11 +13,13 @@ static Analyzer::Step const step4{ Analyzer::Step::DONE, Analyzer::Step::HIDDEN_
 static char const solved_board_string[]     = "524189637361547289879623145653498712987251364142376958238914576415762893796835421";
 static char const solvable_board_string[]   = "024189637361547289879623145653498712987251364142376958238914576415762893796835421";
 static char const unsolvable_board_string[] = "006700400000050070070100030800079016060301750700620004690007023037960040008000967";
+static char const stuck_board_string[]      = "000000039000001005003050800008090006070002000100400000009080050020000600400700000";
 
 static Board const empty_board;
 static Board const solved_board(solved_board_string);
 static Board const solvable_board(solvable_board_string);
 static Board const unsolvable_board(unsolvable_board_string);
+static Board const stuck_board(stuck_board_string);   // Easter Monster, which is beyond the depth of Bifurcation
 
 static Candidates::List unsolvable_candidates{
     0x22e, 0x126, 0x040, 0x080, 0x208, 0x10c, 0x010, 0x300, 0x326,
@@ -50,7 +52,16 @@ TEST(Analyzer_Step, techniqueName)
     EXPECT_STREQ(Analyzer::Step::techniqueName(Analyzer::Step::SIMPLE_COLORING), "simple coloring");
     EXPECT_STREQ(Analyzer::Step::techniqueName(Analyzer::Step::UNIQUE_RECTANGLE), "unique rectangle");
     EXPECT_STREQ(Analyzer::Step::techniqueName(Analyzer::Step::X_CYCLE), "x-cycle");
-    EXPECT_STREQ(Analyzer::Step::techniqueName(Analyzer::Step::LAST), "x-cycle");
+    EXPECT_STREQ(Analyzer::Step::techniqueName(Analyzer::Step::FINNED_X_WING), "finned x-wing");
+    EXPECT_STREQ(Analyzer::Step::techniqueName(Analyzer::Step::FINNED_SWORDFISH), "finned swordfish");
+    EXPECT_STREQ(Analyzer::Step::techniqueName(Analyzer::Step::FINNED_JELLYFISH), "finned jellyfish");
+    EXPECT_STREQ(Analyzer::Step::techniqueName(Analyzer::Step::XYZ_WING), "xyz-wing");
+    EXPECT_STREQ(Analyzer::Step::techniqueName(Analyzer::Step::W_WING), "w-wing");
+    EXPECT_STREQ(Analyzer::Step::techniqueName(Analyzer::Step::ALTERNATING_INFERENCE_CHAIN), "alternating inference chain");
+    EXPECT_STREQ(Analyzer::Step::techniqueName(Analyzer::Step::ALS_XZ), "als-xz");
+    EXPECT_STREQ(Analyzer::Step::techniqueName(Analyzer::Step::ALS_XY_WING), "als-xy-wing");
+    EXPECT_STREQ(Analyzer::Step::techniqueName(Analyzer::Step::BIFURCATION), "bifurcation");
+    EXPECT_STREQ(Analyzer::Step::techniqueName(Analyzer::Step::LAST), "bifurcation");
 }
 
 TEST(Analyzer_Step, actionName)
@@ -107,8 +118,21 @@ TEST(Analyzer, next)
         EXPECT_TRUE(step.values.size() == 1 && step.values[0] == 5);
     }
     {
+        // Only trial and error can make progress
         Analyzer       analyzer(unsolvable_board, unsolvable_candidates);
         Analyzer::Step step = analyzer.next();
+        EXPECT_EQ(step.action, Analyzer::Step::ELIMINATE);
+        EXPECT_EQ(step.technique, Analyzer::Step::BIFURCATION);
+        EXPECT_EQ(step.indexes, std::vector<int>({ 4 }));
+        EXPECT_EQ(step.values, std::vector<int>({ 3 }));
+    }
+    {
+        Analyzer       analyzer(stuck_board);
+        Analyzer::Step step;
+        do
+        {
+            step = analyzer.next();
+        } while (!analyzer.done());
         EXPECT_EQ(step.action, Analyzer::Step::STUCK);
         EXPECT_EQ(step.technique, Analyzer::Step::NONE);
         EXPECT_EQ(step.indexes.size(), 0);
@@ -143,9 +167,12 @@ TEST(Analyzer, done)
         EXPECT_FALSE(analyzer.done());
     }
     {
-        Analyzer analyzer(unsolvable_board, unsolvable_candidates);
+        Analyzer analyzer(stuck_board);
         EXPECT_FALSE(analyzer.done());
-        analyzer.next();
+        while (!analyzer.done())
+        {
+            analyzer.next();
+        }
         EXPECT_TRUE(analyzer.done());
     }
 }
@@ -165,9 +192,12 @@ TEST(Analyzer, stuck)
         EXPECT_FALSE(analyzer.stuck());
     }
     {
-        Analyzer analyzer(unsolvable_board, unsolvable_candidates);
+        Analyzer analyzer(stuck_board);
         EXPECT_FALSE(analyzer.stuck());
-        analyzer.next();
+        while (!analyzer.done())
+        {
+            analyzer.next();
+        }
         EXPECT_TRUE(analyzer.stuck());
     }
 }
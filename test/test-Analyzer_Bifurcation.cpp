@@ -0,0 +1,84 @@
+#include "Analyzer/Bifurcation.h"
+
+#include "Analyzer/Candidates.h"
+#include "Board/Board.h"
+
+#include <gtest/gtest.h>
+
+TEST(Bifurcation, exists)
+{
+    std::vector<int> indexes;
+    std::vector<int> values;
+    std::string      reason;
+
+    // Nothing can be eliminated
+    Candidates::List all(Board::NUM_CELLS, Candidates::ALL);
+    EXPECT_FALSE(Bifurcation(all).exists(indexes, values, reason));
+
+    // A1 is 1 or 2, and A2 and A3 are 1 or 3. If A1 were 1, then A2 and A3 would both have to be 3.
+    Candidates::List candidates(Board::NUM_CELLS, Candidates::ALL);
+    candidates[0] = Candidates::fromValue(1) | Candidates::fromValue(2);
+    candidates[1] = Candidates::fromValue(1) | Candidates::fromValue(3);
+    candidates[2] = Candidates::fromValue(1) | Candidates::fromValue(3);
+    ASSERT_TRUE(Bifurcation(candidates).exists(indexes, values, reason));
+    EXPECT_EQ(indexes, std::vector<int>({ 0 }));
+    EXPECT_EQ(values, std::vector<int>({ 1 }));
+    EXPECT_EQ(reason, "If A1 were 1, then A2 could not be anything. So A1 cannot be 1.");
+
+    // The search stops when the node budget is exhausted
+    Bifurcation limited(candidates, 1);
+    indexes.clear();
+    values.clear();
+    EXPECT_FALSE(limited.exists(indexes, values, reason));
+    EXPECT_EQ(limited.nodes(), 2);
+}
+
+TEST(Bifurcation, hiddenSingles)
+{
+    std::vector<int> indexes;
+    std::vector<int> values;
+    std::string      reason;
+
+    // A1 is 1 or 2, and 2 can only be in A1 or A9 in row A. B9 and I9 are 2 or 3. If A1 were 1, then A9 would have to be 2, and B9
+    // and I9 would both have to be 3.
+    Candidates::List candidates(Board::NUM_CELLS, Candidates::ALL);
+    candidates[0] = Candidates::fromValue(1) | Candidates::fromValue(2);
+    for (int c = 1; c < Board::SIZE - 1; ++c)
+    {
+        candidates[c] &= ~Candidates::fromValue(2);
+    }
+    candidates[17] = Candidates::fromValue(2) | Candidates::fromValue(3);
+    candidates[80] = Candidates::fromValue(2) | Candidates::fromValue(3);
+    ASSERT_TRUE(Bifurcation(candidates).exists(indexes, values, reason));
+    EXPECT_EQ(indexes, std::vector<int>({ 0 }));
+    EXPECT_EQ(values, std::vector<int>({ 1 }));
+}
+
+TEST(Bifurcation, noBivalueCells)
+{
+    std::vector<int> indexes;
+    std::vector<int> values;
+    std::string      reason;
+
+    // A1 is 1, 2 or 3, and A2, A3 and A4 are 1, 4 or 5. There are no bivalue cells, so the cells with 3 candidates are tried. If A1
+    // were 1, then A2, A3 and A4 would all have to be 4 or 5.
+    Candidates::List candidates(Board::NUM_CELLS, Candidates::ALL);
+    candidates[0] = Candidates::fromValue(1) | Candidates::fromValue(2) | Candidates::fromValue(3);
+    for (int c = 1; c <= 3; ++c)
+    {
+        candidates[c] = Candidates::fromValue(1) | Candidates::fromValue(4) | Candidates::fromValue(5);
+    }
+    ASSERT_TRUE(Bifurcation(candidates).exists(indexes, values, reason));
+    EXPECT_EQ(indexes, std::vector<int>({ 0 }));
+    EXPECT_EQ(values, std::vector<int>({ 1 }));
+    EXPECT_EQ(reason,
+              "If A1 were 1, then A2 could be neither 4 (since then A3 could not be anything) nor 5 (since then A3 could not be "
+              "anything). So A1 cannot be 1.");
+}
+
+int main(int argc, char ** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    int rv = RUN_ALL_TESTS();
+    return rv;
+}
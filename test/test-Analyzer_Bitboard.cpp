@@ -0,0 +1,109 @@
+#include "Analyzer/Bitboard.h"
+
+#include "Analyzer/Positions.h"
+#include "Board/Board.h"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(Bitboard, Bitboard)
+{
+    Bitboard empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.count(), 0);
+    EXPECT_EQ(empty.first(), -1);
+
+    // Bits beyond the last cell are ignored
+    Bitboard all(~uint64_t(0), ~uint64_t(0));
+    EXPECT_EQ(all, Bitboard::all());
+    EXPECT_EQ(all.count(), Board::NUM_CELLS);
+}
+
+TEST(Bitboard, cell)
+{
+    for (int i = 0; i < Board::NUM_CELLS; ++i)
+    {
+        Bitboard b = Bitboard::cell(i);
+        EXPECT_TRUE(b.test(i));
+        EXPECT_EQ(b.count(), 1);
+        EXPECT_EQ(b.first(), i);
+    }
+}
+
+TEST(Bitboard, setAndReset)
+{
+    Bitboard b;
+    for (int i : { 0, 63, 64, 80 })
+    {
+        b.set(i);
+    }
+    EXPECT_EQ(b.count(), 4);
+    EXPECT_TRUE(b.test(63));
+    EXPECT_TRUE(b.test(64));
+    EXPECT_FALSE(b.test(62));
+
+    b.reset(0);
+    EXPECT_EQ(b.first(), 63);
+    EXPECT_EQ(b.pop(), 63);
+    EXPECT_EQ(b.pop(), 64);
+    EXPECT_EQ(b.pop(), 80);
+    EXPECT_TRUE(b.empty());
+}
+
+TEST(Bitboard, operators)
+{
+    Bitboard a = Bitboard::cell(1) | Bitboard::cell(70);
+    Bitboard b = Bitboard::cell(70) | Bitboard::cell(80);
+    EXPECT_EQ(a & b, Bitboard::cell(70));
+    EXPECT_EQ((a | b).count(), 3);
+    EXPECT_EQ(a ^ b, Bitboard::cell(1) | Bitboard::cell(80));
+    EXPECT_EQ((~a).count(), Board::NUM_CELLS - 2);
+    EXPECT_EQ(~Bitboard::all(), Bitboard());
+
+    Bitboard c = a;
+    c &= b;
+    EXPECT_EQ(c, Bitboard::cell(70));
+    c |= Bitboard::cell(2);
+    c ^= Bitboard::cell(70);
+    EXPECT_EQ(c, Bitboard::cell(2));
+    EXPECT_NE(c, a);
+}
+
+TEST(Bitboard, indexes)
+{
+    EXPECT_TRUE(Bitboard().indexes().empty());
+
+    Bitboard b;
+    for (int i : { 80, 3, 64, 63 })
+    {
+        b.set(i);
+    }
+    EXPECT_EQ(b.indexes(), (std::vector<int>{ 3, 63, 64, 80 }));
+    EXPECT_EQ(b.count(), 4);
+}
+
+TEST(Bitboard, groupAndPeers)
+{
+    Bitboard row;
+    for (int i : Board::Group::row(2))
+    {
+        row.set(i);
+    }
+    EXPECT_EQ(Bitboard::group(Positions::row(2)), row);
+    EXPECT_EQ(Bitboard::group(Positions::column(7)).count(), Board::SIZE);
+    EXPECT_TRUE(Bitboard::group(Positions::box(4)).test(40));
+
+    EXPECT_EQ(Bitboard::peers(40).count(), 20);
+    EXPECT_FALSE(Bitboard::peers(40).test(40));
+    for (int i : Board::Cell::dependents(40))
+    {
+        EXPECT_TRUE(Bitboard::peers(40).test(i));
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    int rv = RUN_ALL_TESTS();
+    return rv;
+}
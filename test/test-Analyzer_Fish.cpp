@@ -0,0 +1,99 @@
+#include "Analyzer/Fish.h"
+
+#include "Analyzer/Candidates.h"
+#include "Analyzer/LinkGraph.h"
+#include "Board/Board.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// Returns candidates in which 5 can only be in the given columns of rows A and E
+Candidates::List candidatesWith5In(std::vector<int> const & rowA, std::vector<int> const & rowE)
+{
+    Candidates::List candidates(Board::NUM_CELLS, Candidates::ALL);
+    for (int c = 0; c < Board::SIZE; ++c)
+    {
+        candidates[Board::Cell::indexOf(0, c)] &= ~Candidates::fromValue(5);
+        candidates[Board::Cell::indexOf(4, c)] &= ~Candidates::fromValue(5);
+    }
+    for (int c : rowA)
+    {
+        candidates[Board::Cell::indexOf(0, c)] |= Candidates::fromValue(5);
+    }
+    for (int c : rowE)
+    {
+        candidates[Board::Cell::indexOf(4, c)] |= Candidates::fromValue(5);
+    }
+    return candidates;
+}
+} // anonymous namespace
+
+TEST(Fish, exists)
+{
+    std::vector<int> indexes;
+    std::vector<int> values;
+    std::string      reason;
+
+    // No fish
+    EXPECT_FALSE(XWing(LinkGraph()).exists(indexes, values, reason));
+    EXPECT_FALSE(Swordfish(LinkGraph()).exists(indexes, values, reason));
+    EXPECT_FALSE(Jellyfish(LinkGraph()).exists(indexes, values, reason));
+
+    // 5 can only be in columns 2 and 8 of rows A and E, so it cannot be in any other cells of those columns
+    XWing xWing(LinkGraph(candidatesWith5In({ 1, 7 }, { 1, 7 })));
+    ASSERT_TRUE(xWing.exists(indexes, values, reason));
+    EXPECT_EQ(values, std::vector<int>({ 5 }));
+    ASSERT_EQ(indexes.size(), 14);
+    for (int i : indexes)
+    {
+        int r = Board::Group::whichRow(i);
+        int c = Board::Group::whichColumn(i);
+        EXPECT_TRUE(r != 0 && r != 4);
+        EXPECT_TRUE(c == 1 || c == 7);
+    }
+    EXPECT_FALSE(reason.empty());
+
+    // A finned x-wing is not an x-wing
+    indexes.clear();
+    values.clear();
+    EXPECT_FALSE(XWing(LinkGraph(candidatesWith5In({ 1, 6, 7 }, { 1, 7 }))).exists(indexes, values, reason));
+}
+
+TEST(Fish, finnedExists)
+{
+    std::vector<int> indexes;
+    std::vector<int> values;
+    std::string      reason;
+
+    // No fish
+    EXPECT_FALSE(XWing(LinkGraph()).finnedExists(indexes, values, reason));
+
+    // Except for the fin in A7, 5 can only be in columns 2 and 8 of rows A and E. So, it cannot be in B8 or C8, which see both the
+    // fin and A8.
+    XWing finned(LinkGraph(candidatesWith5In({ 1, 6, 7 }, { 1, 7 })));
+    ASSERT_TRUE(finned.finnedExists(indexes, values, reason));
+    EXPECT_EQ(values, std::vector<int>({ 5 }));
+    EXPECT_EQ(indexes, std::vector<int>({ Board::Cell::indexOf(1, 7), Board::Cell::indexOf(2, 7) }));
+    EXPECT_FALSE(reason.empty());
+
+    // Sashimi: only A8 of row A is in the cover, and the fins are A7 and A9
+    indexes.clear();
+    values.clear();
+    XWing sashimi(LinkGraph(candidatesWith5In({ 6, 7, 8 }, { 1, 7 })));
+    ASSERT_TRUE(sashimi.finnedExists(indexes, values, reason));
+    EXPECT_EQ(values, std::vector<int>({ 5 }));
+    EXPECT_EQ(indexes, std::vector<int>({ Board::Cell::indexOf(1, 7), Board::Cell::indexOf(2, 7) }));
+
+    // The fins must be in one box
+    indexes.clear();
+    values.clear();
+    EXPECT_FALSE(XWing(LinkGraph(candidatesWith5In({ 1, 3, 6, 7 }, { 1, 7 }))).finnedExists(indexes, values, reason));
+}
+
+int main(int argc, char ** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    int rv = RUN_ALL_TESTS();
+    return rv;
+}
@@ -0,0 +1,116 @@
+#include "Analyzer/LinkGraph.h"
+
+#include "Analyzer/Bitboard.h"
+#include "Analyzer/Candidates.h"
+#include "Analyzer/Positions.h"
+#include "Board/Board.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// Returns true if two graphs have the same links
+bool same(LinkGraph const & a, LinkGraph const & b)
+{
+    if (a.bivalues() != b.bivalues())
+        return false;
+    for (int v = 1; v <= Board::SIZE; ++v)
+    {
+        if (a.cells(v) != b.cells(v) || a.conjugates(v) != b.conjugates(v))
+            return false;
+        for (int v1 = 1; v1 <= Board::SIZE; ++v1)
+        {
+            if (a.bivalues(v, v1) != b.bivalues(v, v1))
+                return false;
+        }
+        for (int i = 0; i < Board::NUM_CELLS; ++i)
+        {
+            if (a.strong(i, v) != b.strong(i, v) || a.weak(i, v) != b.weak(i, v))
+                return false;
+        }
+    }
+    return true;
+}
+} // anonymous namespace
+
+TEST(LinkGraph, LinkGraph)
+{
+    LinkGraph all;
+    EXPECT_TRUE(same(all, LinkGraph(Candidates::List(Board::NUM_CELLS, Candidates::ALL))));
+    EXPECT_TRUE(all.bivalues().empty());
+    for (int v = 1; v <= Board::SIZE; ++v)
+    {
+        EXPECT_EQ(all.cells(v), Bitboard::all());
+        EXPECT_EQ(all.conjugates(v), 0u);
+        EXPECT_TRUE(all.strong(40, v).empty());
+        EXPECT_EQ(all.weak(40, v), Bitboard::peers(40));
+    }
+}
+
+TEST(LinkGraph, strong)
+{
+    // 5 can only be in A1 and A9 in row A
+    Candidates::List candidates(Board::NUM_CELLS, Candidates::ALL);
+    for (int c = 1; c < Board::SIZE - 1; ++c)
+    {
+        candidates[Board::Cell::indexOf(0, c)] &= ~Candidates::fromValue(5);
+    }
+    LinkGraph graph(candidates);
+    EXPECT_EQ(graph.conjugates(5), 1u << Positions::row(0));
+    EXPECT_EQ(graph.strong(0, 5), Bitboard::cell(8));
+    EXPECT_EQ(graph.strong(8, 5), Bitboard::cell(0));
+    EXPECT_TRUE(graph.strong(0, 4).empty());
+
+    // A conjugate pair is not a weak link
+    EXPECT_FALSE(graph.weak(0, 5).test(8));
+    EXPECT_TRUE(graph.weak(0, 5).test(9));
+    EXPECT_TRUE(graph.weak(0, 4).test(8));
+
+    // Solving a cell removes it from the links
+    candidates[0] = Candidates::fromValue(5);
+    graph.update(0, candidates[0]);
+    EXPECT_FALSE(graph.cells(5).test(0));
+    EXPECT_EQ(graph.conjugates(5), 0u);
+    EXPECT_TRUE(graph.strong(0, 5).empty());
+    EXPECT_TRUE(graph.strong(8, 5).empty());
+}
+
+TEST(LinkGraph, update)
+{
+    Candidates::List candidates(Board::NUM_CELLS, Candidates::ALL);
+    LinkGraph        graph;
+    for (int i = 0; i < Board::NUM_CELLS; i += 2)
+    {
+        for (int v = 1; v <= Board::SIZE; ++v)
+        {
+            if ((i + v) % 3 != 0)
+            {
+                candidates[i] &= ~Candidates::fromValue(v);
+                graph.update(i, candidates[i]);
+            }
+        }
+        EXPECT_TRUE(same(graph, LinkGraph(candidates)));
+    }
+    EXPECT_TRUE(graph.bivalues().empty());
+
+    candidates[1] = Candidates::fromValue(2) | Candidates::fromValue(6);
+    graph.update(1, candidates[1]);
+    EXPECT_EQ(graph.bivalues(), Bitboard::cell(1));
+    EXPECT_EQ(graph.bivalues(2, 6), Bitboard::cell(1));
+    EXPECT_EQ(graph.bivalues(6, 2), Bitboard::cell(1));
+    EXPECT_TRUE(graph.bivalues(2, 3).empty());
+    EXPECT_TRUE(same(graph, LinkGraph(candidates)));
+
+    // Solving a bivalue removes it from the index of its pair
+    candidates[1] = Candidates::fromValue(2);
+    graph.update(1, candidates[1]);
+    EXPECT_TRUE(graph.bivalues(2, 6).empty());
+    EXPECT_TRUE(same(graph, LinkGraph(candidates)));
+}
+
+int main(int argc, char ** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    int rv = RUN_ALL_TESTS();
+    return rv;
+}
@@ -1,13 +1,48 @@
 #include "Analyzer/LockedCandidates.h"
 
+#include "Analyzer/Candidates.h"
+#include "Analyzer/LinkGraph.h"
+#include "Board/Board.h"
+
 #include <gtest/gtest.h>
 
-TEST(LockedCandidates, DISABLED_LockedCandidates)
+TEST(LockedCandidates, exists)
 {
-}
+    std::vector<int> indexes;
+    std::vector<int> values;
+    std::string      reason;
 
-TEST(LockedCandidates, DISABLED_exists)
-{
+    // No locked candidates
+    LinkGraph all;
+    EXPECT_FALSE(LockedCandidates(all).exists(indexes, values, reason));
+
+    // 5 can only be in A1, A2 and A3 in row A, so it cannot be anywhere else in box 1
+    Candidates::List claiming(Board::NUM_CELLS, Candidates::ALL);
+    for (int c = Board::BOX_SIZE; c < Board::SIZE; ++c)
+    {
+        claiming[Board::Cell::indexOf(0, c)] &= ~Candidates::fromValue(5);
+    }
+    LinkGraph claimingLinks(claiming);
+    ASSERT_TRUE(LockedCandidates(claimingLinks).exists(indexes, values, reason));
+    EXPECT_EQ(values, std::vector<int>({ 5 }));
+    EXPECT_EQ(indexes, std::vector<int>({ 9, 10, 11, 18, 19, 20 }));
+    EXPECT_FALSE(reason.empty());
+
+    // 5 can only be in A1, B1 and C1 in box 1, so it cannot be anywhere else in column 1
+    Candidates::List pointing(Board::NUM_CELLS, Candidates::ALL);
+    for (int r = 0; r < Board::BOX_SIZE; ++r)
+    {
+        for (int c = 1; c < Board::BOX_SIZE; ++c)
+        {
+            pointing[Board::Cell::indexOf(r, c)] &= ~Candidates::fromValue(5);
+        }
+    }
+    LinkGraph pointingLinks(pointing);
+    indexes.clear();
+    values.clear();
+    ASSERT_TRUE(LockedCandidates(pointingLinks).exists(indexes, values, reason));
+    EXPECT_EQ(values, std::vector<int>({ 5 }));
+    EXPECT_EQ(indexes, std::vector<int>({ 27, 36, 45, 54, 63, 72 }));
 }
 
 int main(int argc, char ** argv)
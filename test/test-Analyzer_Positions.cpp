@@ -0,0 +1,97 @@
+#include "Analyzer/Positions.h"
+
+#include "Analyzer/Candidates.h"
+#include "Board/Board.h"
+
+#include <gtest/gtest.h>
+
+TEST(Positions, Positions)
+{
+    Positions all;
+    Positions fromCandidates(Candidates::List(Board::NUM_CELLS, Candidates::ALL));
+    for (int g = 0; g < Positions::NUM_GROUPS; ++g)
+    {
+        for (int v = 1; v <= Board::SIZE; ++v)
+        {
+            EXPECT_EQ(all.get(g, v), Positions::ALL);
+            EXPECT_EQ(fromCandidates.get(g, v), Positions::ALL);
+        }
+    }
+
+    // The positions are the transpose of the candidates
+    Candidates::List candidates(Board::NUM_CELLS, Candidates::ALL);
+    candidates[Board::Cell::indexOf(4, 5)] = Candidates::fromValue(3) | Candidates::fromValue(7);
+    Positions positions(candidates);
+    EXPECT_EQ(positions.get(Positions::row(4), 3), Positions::ALL);
+    EXPECT_EQ(positions.get(Positions::row(4), 1), Positions::ALL & ~(1u << 5));
+    EXPECT_EQ(positions.get(Positions::column(5), 1), Positions::ALL & ~(1u << 4));
+    EXPECT_EQ(positions.get(Positions::box(4), 1), Positions::ALL & ~(1u << 5));
+}
+
+TEST(Positions, eliminate)
+{
+    Candidates::List candidates(Board::NUM_CELLS, Candidates::ALL);
+    Positions        positions(candidates);
+    for (int i : { 0, 40, 80 })
+    {
+        for (int v : { 2, 9 })
+        {
+            positions.eliminate(i, v);
+            candidates[i] &= ~Candidates::fromValue(v);
+        }
+    }
+
+    Positions expected(candidates);
+    for (int g = 0; g < Positions::NUM_GROUPS; ++g)
+    {
+        for (int v = 1; v <= Board::SIZE; ++v)
+        {
+            EXPECT_EQ(positions.get(g, v), expected.get(g, v));
+        }
+    }
+    EXPECT_EQ(positions.get(Positions::box(8), 9), Positions::ALL & ~(1u << 8));
+}
+
+TEST(Positions, update)
+{
+    Candidates::List candidates(Board::NUM_CELLS, Candidates::ALL);
+    Positions        positions(candidates);
+
+    // Solving a cell removes all of its other candidates, and restoring a candidate adds it back
+    positions.update(10, candidates[10], Candidates::fromValue(4));
+    candidates[10] = Candidates::fromValue(4);
+    positions.update(20, candidates[20], Candidates::fromValue(5) | Candidates::fromValue(6));
+    candidates[20] = Candidates::fromValue(5) | Candidates::fromValue(6);
+    positions.update(20, candidates[20], Candidates::fromValue(5) | Candidates::fromValue(7));
+    candidates[20] = Candidates::fromValue(5) | Candidates::fromValue(7);
+
+    Positions expected(candidates);
+    for (int g = 0; g < Positions::NUM_GROUPS; ++g)
+    {
+        for (int v = 1; v <= Board::SIZE; ++v)
+        {
+            EXPECT_EQ(positions.get(g, v), expected.get(g, v));
+        }
+    }
+}
+
+TEST(Positions, indexes)
+{
+    EXPECT_EQ(Positions::indexes(Positions::row(3)), Board::Group::row(3));
+    EXPECT_EQ(Positions::indexes(Positions::column(3)), Board::Group::column(3));
+    EXPECT_EQ(Positions::indexes(Positions::box(3)), Board::Group::box(3));
+}
+
+TEST(Positions, name)
+{
+    EXPECT_EQ(Positions::name(Positions::row(8)), "row J");
+    EXPECT_EQ(Positions::name(Positions::column(0)), "column 1");
+    EXPECT_EQ(Positions::name(Positions::box(4)), "box 5");
+}
+
+int main(int argc, char ** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    int rv = RUN_ALL_TESTS();
+    return rv;
+}
@@ -0,0 +1,113 @@
+#include "Analyzer/Subset.h"
+
+#include "Analyzer/Candidates.h"
+#include "Analyzer/Positions.h"
+#include "Board/Board.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+TEST(Subset_Naked, exists)
+{
+    // A1 and A2 can only be 1 or 2, so no other cell in row A can be 1 or 2
+    Candidates::List candidates(Board::NUM_CELLS, Candidates::ALL);
+    candidates[0] = Candidates::fromValue(1) | Candidates::fromValue(2);
+    candidates[1] = Candidates::fromValue(1) | Candidates::fromValue(2);
+
+    std::vector<int> indexes;
+    std::vector<int> values;
+    std::string      reason;
+    ASSERT_TRUE(NakedSubset<2>(candidates).exists(indexes, values, reason));
+    EXPECT_EQ(indexes, (std::vector<int>{ 2, 3, 4, 5, 6, 7, 8 }));
+    EXPECT_EQ(values, (std::vector<int>{ 1, 2 }));
+    EXPECT_EQ(reason,
+              "Two other squares (A1 and A2) in row A must be one of these two values, so these squares cannot be either of these two "
+              "values.");
+
+    // There are no triples or quads
+    indexes.clear();
+    values.clear();
+    EXPECT_FALSE(NakedSubset<3>(candidates).exists(indexes, values, reason));
+    EXPECT_FALSE(NakedSubset<4>(candidates).exists(indexes, values, reason));
+    EXPECT_TRUE(indexes.empty());
+    EXPECT_TRUE(values.empty());
+}
+
+TEST(Subset_Naked, existsTriple)
+{
+    // B1, B5 and B9 together can only be 4, 5 or 6 (but none of them can be all three), so no other cell in row B can be 4, 5 or 6
+    Candidates::List candidates(Board::NUM_CELLS, Candidates::ALL);
+    candidates[9]  = Candidates::fromValue(4) | Candidates::fromValue(5);
+    candidates[13] = Candidates::fromValue(5) | Candidates::fromValue(6);
+    candidates[17] = Candidates::fromValue(4) | Candidates::fromValue(6);
+
+    std::vector<int> indexes;
+    std::vector<int> values;
+    std::string      reason;
+    EXPECT_FALSE(NakedSubset<2>(candidates).exists(indexes, values, reason));
+    ASSERT_TRUE(NakedSubset<3>(candidates).exists(indexes, values, reason));
+    EXPECT_EQ(indexes, (std::vector<int>{ 10, 11, 12, 14, 15, 16 }));
+    EXPECT_EQ(values, (std::vector<int>{ 4, 5, 6 }));
+    EXPECT_EQ(reason,
+              "Three other squares (B1, B5 and B9) in row B must be one of these three values, so these squares cannot be any of "
+              "these three values.");
+}
+
+TEST(Subset_Hidden, exists)
+{
+    // Only A1 and A2 in row A can be 1 or 2, so they cannot be anything else
+    Candidates::List candidates(Board::NUM_CELLS, Candidates::ALL);
+    for (int i = 2; i < Board::SIZE; ++i)
+    {
+        candidates[i] &= ~(Candidates::fromValue(1) | Candidates::fromValue(2));
+    }
+
+    Positions        positions(candidates);
+    std::vector<int> indexes;
+    std::vector<int> values;
+    std::string      reason;
+    ASSERT_TRUE(HiddenSubset<2>(candidates, &positions).exists(indexes, values, reason));
+    EXPECT_EQ(indexes, (std::vector<int>{ 0, 1 }));
+    EXPECT_EQ(values, (std::vector<int>{ 3, 4, 5, 6, 7, 8, 9 }));
+    EXPECT_EQ(reason, "Only these two squares in row A can be 1 or 2, so they cannot be any other values.");
+
+    // Once the other values are eliminated, there is nothing more to find
+    candidates[0] = candidates[1] = Candidates::fromValue(1) | Candidates::fromValue(2);
+    positions     = Positions(candidates);
+    indexes.clear();
+    values.clear();
+    EXPECT_FALSE(HiddenSubset<2>(candidates, &positions).exists(indexes, values, reason));
+    EXPECT_FALSE(HiddenSubset<3>(candidates, &positions).exists(indexes, values, reason));
+    EXPECT_FALSE(HiddenSubset<4>(candidates, &positions).exists(indexes, values, reason));
+}
+
+TEST(Subset_Hidden, existsQuad)
+{
+    // Only A1, A2, A3 and A4 in row A can be 1, 2, 3 or 4
+    Candidates::List candidates(Board::NUM_CELLS, Candidates::ALL);
+    Candidates::Type quad = Candidates::fromValue(1) | Candidates::fromValue(2) | Candidates::fromValue(3) | Candidates::fromValue(4);
+    for (int i = 4; i < Board::SIZE; ++i)
+    {
+        candidates[i] &= ~quad;
+    }
+
+    Positions        positions(candidates);
+    std::vector<int> indexes;
+    std::vector<int> values;
+    std::string      reason;
+    EXPECT_FALSE(HiddenSubset<2>(candidates, &positions).exists(indexes, values, reason));
+    EXPECT_FALSE(HiddenSubset<3>(candidates, &positions).exists(indexes, values, reason));
+    ASSERT_TRUE(HiddenSubset<4>(candidates, &positions).exists(indexes, values, reason));
+    EXPECT_EQ(indexes, (std::vector<int>{ 0, 1, 2, 3 }));
+    EXPECT_EQ(values, (std::vector<int>{ 5, 6, 7, 8, 9 }));
+    EXPECT_EQ(reason, "Only these four squares in row A can be 1, 2, 3, or 4, so they cannot be any other values.");
+}
+
+int main(int argc, char ** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    int rv = RUN_ALL_TESTS();
+    return rv;
+}
@@ -1,5 +1,9 @@
 #include "Analyzer/UniqueRectangle.h"
 
+#include "Analyzer/Candidates.h"
+#include "Analyzer/LinkGraph.h"
+#include "Board/Board.h"
+
 #include <gtest/gtest.h>
 
 // Type 1:
@@ -9,12 +13,85 @@
 // 420900386060200794809060251700003025900102603200500008004020567682700439000000812
 // 070903082000020000200407001605002109020004060708000205900205006002070000010309020
 
-TEST(UniqueRectangle, DISABLED_UniqueRectangle)
+namespace
+{
+Candidates::Type constexpr PAIR = (1 << 1) | (1 << 2);
+
+// Finds a unique rectangle in the candidates
+bool find(Candidates::List const & candidates, std::vector<int> & indexes, std::vector<int> & values)
 {
+    LinkGraph   links(candidates);
+    std::string reason;
+    indexes.clear();
+    values.clear();
+    bool found = UniqueRectangle(candidates, links).exists(indexes, values, reason);
+    EXPECT_TRUE(!found || !reason.empty());
+    return found;
 }
+} // anonymous namespace
 
-TEST(UniqueRectangle, DISABLED_exists)
+TEST(UniqueRectangle, exists)
 {
+    std::vector<int> indexes;
+    std::vector<int> values;
+
+    // No unique rectangles
+    EXPECT_FALSE(find(Candidates::List(Board::NUM_CELLS, Candidates::ALL), indexes, values));
+
+    // Type 1: A1, A4 and B1 are 1 or 2, so B4 cannot be either
+    Candidates::List type1(Board::NUM_CELLS, Candidates::ALL);
+    type1[0]  = PAIR;
+    type1[3]  = PAIR;
+    type1[9]  = PAIR;
+    type1[12] = PAIR | Candidates::fromValue(3);
+    ASSERT_TRUE(find(type1, indexes, values));
+    EXPECT_EQ(indexes, std::vector<int>({ 12 }));
+    EXPECT_EQ(values, std::vector<int>({ 1, 2 }));
+
+    // Type 2B: One of B1 or B4 must be 3, so the rest of row B cannot be 3
+    Candidates::List type2B(Board::NUM_CELLS, Candidates::ALL);
+    type2B[0]  = PAIR;
+    type2B[3]  = PAIR;
+    type2B[9]  = PAIR | Candidates::fromValue(3);
+    type2B[12] = PAIR | Candidates::fromValue(3);
+    ASSERT_TRUE(find(type2B, indexes, values));
+    EXPECT_EQ(indexes, std::vector<int>({ 10, 11, 13, 14, 15, 16, 17 }));
+    EXPECT_EQ(values, std::vector<int>({ 3 }));
+
+    // Type 2C: One of A4 or B1 must be 3, so A2, A3, B5 and B6 cannot be 3
+    Candidates::List type2C(Board::NUM_CELLS, Candidates::ALL);
+    type2C[0]  = PAIR;
+    type2C[12] = PAIR;
+    type2C[3]  = PAIR | Candidates::fromValue(3);
+    type2C[9]  = PAIR | Candidates::fromValue(3);
+    ASSERT_TRUE(find(type2C, indexes, values));
+    EXPECT_EQ(indexes, std::vector<int>({ 1, 2, 13, 14 }));
+    EXPECT_EQ(values, std::vector<int>({ 3 }));
+
+    // Type 3B: One of B1 or B4 must be 5 or 6, and B9 is 5 or 6, so the rest of row B cannot be 5 or 6
+    Candidates::List type3(Board::NUM_CELLS, Candidates::ALL);
+    type3[0]  = PAIR;
+    type3[3]  = PAIR;
+    type3[9]  = PAIR | Candidates::fromValue(5);
+    type3[12] = PAIR | Candidates::fromValue(6);
+    type3[17] = Candidates::fromValue(5) | Candidates::fromValue(6);
+    ASSERT_TRUE(find(type3, indexes, values));
+    EXPECT_EQ(indexes, std::vector<int>({ 10, 11, 13, 14, 15, 16 }));
+    EXPECT_EQ(values, std::vector<int>({ 5, 6 }));
+
+    // Type 4B: Only B1 and B4 can be 1 in row B, so neither can be 2
+    Candidates::List type4(Board::NUM_CELLS, Candidates::ALL);
+    for (int c = 0; c < Board::SIZE; ++c)
+    {
+        type4[Board::Cell::indexOf(1, c)] &= ~Candidates::fromValue(1);
+    }
+    type4[0]  = PAIR;
+    type4[3]  = PAIR;
+    type4[9]  = PAIR | Candidates::fromValue(5);
+    type4[12] = PAIR | Candidates::fromValue(6);
+    ASSERT_TRUE(find(type4, indexes, values));
+    EXPECT_EQ(indexes, std::vector<int>({ 9, 12 }));
+    EXPECT_EQ(values, std::vector<int>({ 2 }));
 }
 
 int main(int argc, char ** argv)
@@ -0,0 +1,47 @@
+#include "Analyzer/WWing.h"
+
+#include "Analyzer/Candidates.h"
+#include "Analyzer/LinkGraph.h"
+#include "Board/Board.h"
+
+#include <gtest/gtest.h>
+
+TEST(WWing, exists)
+{
+    std::vector<int> indexes;
+    std::vector<int> values;
+    std::string      reason;
+
+    // No w-wings
+    LinkGraph all;
+    EXPECT_FALSE(WWing(all).exists(indexes, values, reason));
+
+    // A1 and E5 are 1 or 2, and 1 can only be in I1 or I5 in row I, so A5 and E1 cannot be 2
+    Candidates::List candidates(Board::NUM_CELLS, Candidates::ALL);
+    for (int c = 0; c < Board::SIZE; ++c)
+    {
+        if (c != 0 && c != 4)
+            candidates[Board::Cell::indexOf(8, c)] &= ~Candidates::fromValue(1);
+    }
+    candidates[0]  = Candidates::fromValue(1) | Candidates::fromValue(2);
+    candidates[40] = Candidates::fromValue(1) | Candidates::fromValue(2);
+    LinkGraph links(candidates);
+    ASSERT_TRUE(WWing(links).exists(indexes, values, reason));
+    EXPECT_EQ(indexes, std::vector<int>({ 4, 36 }));
+    EXPECT_EQ(values, std::vector<int>({ 2 }));
+    EXPECT_FALSE(reason.empty());
+
+    // Without the conjugate pair, there is no w-wing
+    candidates[Board::Cell::indexOf(8, 8)] |= Candidates::fromValue(1);
+    LinkGraph unlinked(candidates);
+    indexes.clear();
+    values.clear();
+    EXPECT_FALSE(WWing(unlinked).exists(indexes, values, reason));
+}
+
+int main(int argc, char ** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    int rv = RUN_ALL_TESTS();
+    return rv;
+}
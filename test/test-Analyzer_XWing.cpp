@@ -1,34 +0,0 @@
-#include "Analyzer/XWing.h"
-
-#include <gtest/gtest.h>
-
-TEST(XWing_XWing, DISABLED_XWing)
-{
-}
-
-TEST(XWing_XWing, DISABLED_exists)
-{
-}
-
-TEST(XWing_Swordfish, DISABLED_Swordfish)
-{
-}
-
-TEST(XWing_Swordfish, DISABLED_exists)
-{
-}
-
-TEST(XWing_Jellyfish, DISABLED_Jellyfish)
-{
-}
-
-TEST(XWing_Jellyfish, DISABLED_exists)
-{
-}
-
-int main(int argc, char ** argv)
-{
-    ::testing::InitGoogleTest(&argc, argv);
-    int rv = RUN_ALL_TESTS();
-    return rv;
-}
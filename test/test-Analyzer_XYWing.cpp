@@ -1,13 +1,32 @@
 #include "Analyzer/XYWing.h"
 
+#include "Analyzer/Candidates.h"
+#include "Analyzer/LinkGraph.h"
+#include "Board/Board.h"
+
 #include <gtest/gtest.h>
 
-TEST(XYWing, DISABLED_XYWing)
+TEST(XYWing, exists)
 {
-}
+    std::vector<int> indexes;
+    std::vector<int> values;
+    std::string      reason;
 
-TEST(XYWing, DISABLED_exists)
-{
+    // No xy-wings
+    Candidates::List all(Board::NUM_CELLS, Candidates::ALL);
+    LinkGraph        allLinks(all);
+    EXPECT_FALSE(XYWing(all, allLinks).exists(indexes, values, reason));
+
+    // A1 is 1 or 2, A5 is 1 or 3, and E1 is 2 or 3, so E5 cannot be 3
+    Candidates::List candidates(Board::NUM_CELLS, Candidates::ALL);
+    candidates[0]  = Candidates::fromValue(1) | Candidates::fromValue(2);
+    candidates[4]  = Candidates::fromValue(1) | Candidates::fromValue(3);
+    candidates[36] = Candidates::fromValue(2) | Candidates::fromValue(3);
+    LinkGraph links(candidates);
+    ASSERT_TRUE(XYWing(candidates, links).exists(indexes, values, reason));
+    EXPECT_EQ(indexes, std::vector<int>({ 40 }));
+    EXPECT_EQ(values, std::vector<int>({ 3 }));
+    EXPECT_FALSE(reason.empty());
 }
 
 int main(int argc, char ** argv)
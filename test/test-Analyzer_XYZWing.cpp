@@ -0,0 +1,37 @@
+#include "Analyzer/XYZWing.h"
+
+#include "Analyzer/Candidates.h"
+#include "Analyzer/LinkGraph.h"
+#include "Board/Board.h"
+
+#include <gtest/gtest.h>
+
+TEST(XYZWing, exists)
+{
+    std::vector<int> indexes;
+    std::vector<int> values;
+    std::string      reason;
+
+    // No xyz-wings
+    Candidates::List all(Board::NUM_CELLS, Candidates::ALL);
+    LinkGraph        allLinks(all);
+    EXPECT_FALSE(XYZWing(all, allLinks).exists(indexes, values, reason));
+
+    // A1 is 1, 2 or 3, A2 is 1 or 3, and B1 is 2 or 3, so the other squares in box 1 cannot be 3
+    Candidates::List candidates(Board::NUM_CELLS, Candidates::ALL);
+    candidates[0] = Candidates::fromValue(1) | Candidates::fromValue(2) | Candidates::fromValue(3);
+    candidates[1] = Candidates::fromValue(1) | Candidates::fromValue(3);
+    candidates[9] = Candidates::fromValue(2) | Candidates::fromValue(3);
+    LinkGraph links(candidates);
+    ASSERT_TRUE(XYZWing(candidates, links).exists(indexes, values, reason));
+    EXPECT_EQ(indexes, std::vector<int>({ 2, 10, 11, 18, 19, 20 }));
+    EXPECT_EQ(values, std::vector<int>({ 3 }));
+    EXPECT_FALSE(reason.empty());
+}
+
+int main(int argc, char ** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    int rv = RUN_ALL_TESTS();
+    return rv;
+}
@@ -1,11 +1,214 @@
 #include "Generator/Generator.h"
 
+#include "Analyzer/Analyzer.h"
+#include "Board/Board.h"
+#include "Solver/Solver.h"
+
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 TEST(Generator, DISABLED_generate)
 {
 }
 
+TEST(Generator, generateSolvedBoards)
+{
+    Generator::seed(1);
+    std::vector<Board> boards = Generator::generateSolvedBoards(100, 3);
+    ASSERT_EQ(boards.size(), 100u);
+    for (auto const & b : boards)
+    {
+        EXPECT_TRUE(b.solved());
+    }
+}
+
+TEST(Generator, generateFromSolution)
+{
+    Board solution("689341572124675839375298614846512397792483165513769248261954783958137426437826951");
+    Generator::seed(1);
+    Generator::resetStats();
+    std::vector<Board> boards = Generator::generateFromSolution(solution, 5, 3.0f);
+    ASSERT_EQ(boards.size(), 5u);
+    for (size_t b = 0; b < boards.size(); ++b)
+    {
+        for (int i = 0; i < Board::NUM_CELLS; ++i)
+        {
+            EXPECT_TRUE(boards[b].isEmpty(i) || boards[b].get(i) == solution.get(i));
+        }
+        EXPECT_TRUE(Solver::hasUniqueSolution(boards[b]));
+        for (size_t other = 0; other < b; ++other)
+        {
+            EXPECT_NE(boards[b].cells(), boards[other].cells());
+        }
+    }
+
+    // Later boards reuse the uniqueness results of earlier ones
+    EXPECT_GT(Generator::stats().uniquenessCached, 0u);
+}
+
+TEST(Generator, generateMinimal)
+{
+    Generator::seed(1);
+    Board board = Generator::generateMinimal(3.0f);
+    EXPECT_TRUE(Solver::hasUniqueSolution(board));
+    EXPECT_TRUE(Generator::redundantClues(board).empty());
+}
+
+TEST(Generator, searchMinimal)
+{
+    // Whether a board with few enough clues is found in time depends on the speed of the machine, so the result is checked against
+    // the board rather than expected to be true.
+    Generator::seed(1);
+    Board board;
+    bool  found = Generator::searchMinimal(30, std::chrono::seconds(10), board);
+    int   clues = 0;
+    for (int i = 0; i < Board::NUM_CELLS; ++i)
+    {
+        if (!board.isEmpty(i))
+            ++clues;
+    }
+    if (clues == 0)
+    {
+        EXPECT_FALSE(found);
+        return;
+    }
+    EXPECT_TRUE(Solver::hasUniqueSolution(board));
+    EXPECT_TRUE(Generator::redundantClues(board).empty());
+    EXPECT_EQ(found, clues <= 30);
+
+    // If no minimal board is found at all, then the board is not changed
+    std::string original = "689341572124675839375298614846512397792483165513769248261954783958137426437826951";
+    Board       unchanged(original.c_str());
+    EXPECT_FALSE(Generator::searchMinimal(30, std::chrono::milliseconds(0), unchanged));
+    std::string serialized;
+    unchanged.serialize(serialized);
+    EXPECT_EQ(serialized, original);
+}
+
+TEST(Generator, redundantClues)
+{
+    // A clue added to a minimal board from its solution is redundant
+    Generator::seed(1);
+    Board minimal = Generator::generateMinimal();
+    ASSERT_TRUE(Generator::redundantClues(minimal).empty());
+
+    Board solution = minimal;
+    ASSERT_TRUE(Solver::solve(solution));
+    int added = 0;
+    while (!minimal.isEmpty(added))
+        ++added;
+    Board board = minimal;
+    board.set(added, solution.get(added));
+    std::vector<int> redundant = Generator::redundantClues(board);
+    EXPECT_NE(std::find(redundant.begin(), redundant.end(), added), redundant.end());
+}
+
+TEST(Generator, generateWithPattern)
+{
+    char const pattern[] = "xx.....xxx...x...x..x.x.x.....x.x.....x.x.x.....x.x.....x.x.x..x...x...xxx.....xx";
+    Generator::Pattern cells;
+    for (int i = 0; i < Board::NUM_CELLS; ++i)
+    {
+        cells[i] = pattern[i] == 'x';
+    }
+
+    Board board;
+    ASSERT_TRUE(Generator::generateWithPattern(cells, std::chrono::seconds(10), board));
+    EXPECT_TRUE(board.consistent());
+    for (int i = 0; i < Board::NUM_CELLS; ++i)
+    {
+        EXPECT_EQ(!board.isEmpty(i), cells.test(i));
+    }
+
+    // 16 clues can never have a unique solution
+    Generator::Pattern tooFew;
+    for (int i = 0; i < 16; ++i)
+    {
+        tooFew[i * 5] = true;
+    }
+    EXPECT_FALSE(Generator::generateWithPattern(tooFew, std::chrono::milliseconds(100), board));
+}
+
+TEST(Generator, stats)
+{
+    Generator::seed(1);
+    Generator::resetStats();
+    Board board = Generator::generate(2.0f, 1.0f);
+    EXPECT_TRUE(Solver::hasUniqueSolution(board));
+
+    Generator::Stats stats = Generator::stats();
+    EXPECT_GE(stats.solvedBoards, 1u);
+    EXPECT_EQ(stats.tooEasy, stats.solvedBoards - 1);
+    EXPECT_GE(stats.removals, (uint64_t)Board::NUM_CELLS);
+    EXPECT_EQ(stats.removals, stats.uniquenessSearches + stats.uniquenessSkipped + stats.uniquenessCached);
+    EXPECT_LE(stats.notUnique, stats.uniquenessSearches);
+    EXPECT_GT(stats.uniquenessSkipped, 0u); // Most removals from a nearly full board are forced by singles
+    EXPECT_GT(stats.difficultyTime.count(), 0);
+
+    Generator::resetStats();
+    stats = Generator::stats();
+    EXPECT_EQ(stats.solvedBoards, 0u);
+    EXPECT_EQ(stats.removals, 0u);
+    EXPECT_EQ(stats.uniquenessTime.count(), 0);
+}
+
+TEST(Generator, randomState)
+{
+    // Restoring the random state repeats the same puzzle
+    Generator::seed(1);
+    std::string state = Generator::randomState();
+    Board       first = Generator::generate(3.0f);
+    ASSERT_TRUE(Generator::setRandomState(state));
+    Board again = Generator::generate(3.0f);
+    EXPECT_EQ(first.cells(), again.cells());
+
+    EXPECT_FALSE(Generator::setRandomState("not a state"));
+}
+
+TEST(Generator, search)
+{
+    Generator::seed(1);
+    float difficulty = 0.0f;
+    Board board;
+    bool  found = Generator::search(2.0f, 1.0f, std::chrono::seconds(10), board, &difficulty);
+    EXPECT_TRUE(Solver::hasUniqueSolution(board));
+    EXPECT_EQ(found, difficulty >= 1.0f && difficulty < 3.0f);
+}
+
+TEST(Generator, generateWithTechniques)
+{
+    Generator::seed(1);
+    Generator::TechniqueSet required  = Generator::TechniqueSet(1) << Analyzer::Step::HIDDEN_SINGLE;
+    Generator::TechniqueSet forbidden = Generator::TechniqueSet(1) << Analyzer::Step::X_CYCLE;
+    Board board;
+    ASSERT_TRUE(Generator::generateWithTechniques(required, forbidden, std::chrono::seconds(10), board));
+    EXPECT_TRUE(Solver::hasUniqueSolution(board));
+    Generator::TechniqueSet techniques = 0;
+    Generator::computeDifficulty(board, &techniques);
+    EXPECT_EQ(techniques & required, required);
+    EXPECT_EQ(techniques & forbidden, 0u);
+}
+
+TEST(Generator, generateWithTechniquesForbiddenOnly)
+{
+    Generator::seed(1);
+    Generator::TechniqueSet forbidden = Generator::TechniqueSet(1) << Analyzer::Step::X_CYCLE;
+    Board board;
+    ASSERT_TRUE(Generator::generateWithTechniques(0, forbidden, std::chrono::seconds(10), board));
+    EXPECT_TRUE(Solver::hasUniqueSolution(board));
+    Generator::TechniqueSet techniques = 0;
+    Generator::computeDifficulty(board, &techniques);
+    EXPECT_EQ(techniques & forbidden, 0u);
+    int clues = 0;
+    for (int i = 0; i < Board::NUM_CELLS; ++i)
+    {
+        if (!board.isEmpty(i))
+            ++clues;
+    }
+    EXPECT_LE(clues, 40);
+}
+
 int main(int argc, char ** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,64 @@
+#include "Generator/PuzzleBank.h"
+
+#include "Board/Board.h"
+#include "Generator/Generator.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+TEST(PuzzleBank, writeAndOpen)
+{
+    char const * path = "test-PuzzleBank.bin";
+
+    Board easy("...9.6.......3....1.74..3.2.1.....7...23.48...4.....6.6.1..52.9....4.......1.2...");
+    Board other("7.8...3.....2.1...5.........4.....263...8.......1...9..9.6....4....7.5...........");
+    std::vector<PuzzleBank::Entry> entries =
+    {
+        { other, 4.25f, 0x10u },
+        { easy, 1.5f, 0x22u },
+        { easy, 0.25f, 0u },                // Out of range, so it is omitted
+        { other, 3.75f, 0x14u },
+    };
+    ASSERT_TRUE(PuzzleBank::write(path, entries));
+
+    PuzzleBank bank;
+    ASSERT_TRUE(bank.open(path));
+    EXPECT_EQ(bank.count(1), 0u);
+    EXPECT_EQ(bank.count(2), 1u);
+    EXPECT_EQ(bank.count(3), 0u);
+    EXPECT_EQ(bank.count(4), 2u);
+    EXPECT_EQ(bank.count(0), 0u);
+    EXPECT_EQ(bank.count(10), 0u);
+
+    PuzzleBank::Record const & record = bank.get(2, 0);
+    EXPECT_EQ(record.board().cells(), easy.cells());
+    EXPECT_EQ(record.rating, 1.5f);
+    EXPECT_EQ(record.techniques, 0x22u);
+
+    // Records of the same difficulty keep their order
+    EXPECT_EQ(bank.get(4, 0).rating, 4.25f);
+    EXPECT_EQ(bank.get(4, 1).rating, 3.75f);
+    EXPECT_EQ(bank.get(4, 1).board().cells(), other.cells());
+
+    std::mt19937 rng(1);
+    EXPECT_EQ(bank.random(3, rng), nullptr);
+    PuzzleBank::Record const * r = bank.random(4, rng);
+    ASSERT_NE(r, nullptr);
+    EXPECT_EQ(r->board().cells(), other.cells());
+
+    bank.close();
+    EXPECT_EQ(bank.count(2), 0u);
+
+    // Not a bank file
+    FILE * fp = fopen(path, "wb");
+    ASSERT_NE(fp, nullptr);
+    fputs("not a puzzle bank, but long enough to hold a header and an index of the right size.....", fp);
+    fclose(fp);
+    EXPECT_FALSE(bank.open(path));
+    EXPECT_FALSE(bank.open("does-not-exist.bin"));
+
+    remove(path);
+}
@@ -0,0 +1,51 @@
+#include "Generator/PuzzlePool.h"
+
+#include "Board/Board.h"
+#include "Solver/Solver.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+TEST(PuzzlePool, take)
+{
+    PuzzlePool pool(2, 2);
+
+    // Nothing is out of range
+    Board board;
+    EXPECT_FALSE(pool.take(0.0f, board));
+    EXPECT_FALSE(pool.take(float(PuzzlePool::MAX_DIFFICULTY + 1), board));
+
+    // Wait for a puzzle of any difficulty
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    int  filled   = 0;
+    while (filled == 0 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        for (int d = 1; d <= PuzzlePool::MAX_DIFFICULTY && filled == 0; ++d)
+        {
+            if (pool.size(float(d)) > 0)
+                filled = d;
+        }
+    }
+    ASSERT_GT(filled, 0);
+
+    float rating = 0.0f;
+    ASSERT_TRUE(pool.take(float(filled), board, &rating));
+    EXPECT_TRUE(Solver::hasUniqueSolution(board));
+    EXPECT_EQ(std::min((int)std::lround(rating), PuzzlePool::MAX_DIFFICULTY), filled);
+
+    PuzzlePool::Metrics metrics = pool.metrics();
+    EXPECT_EQ(metrics.capacity, 2);
+    EXPECT_EQ(metrics.taken, 1u);
+    EXPECT_EQ(metrics.missed, 2u);
+    EXPECT_GE(metrics.generated, 1u);
+    EXPECT_LE(metrics.searchesMissed, metrics.generated);
+    for (int size : metrics.sizes)
+    {
+        EXPECT_LE(size, 2);
+    }
+}
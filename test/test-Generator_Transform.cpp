@@ -0,0 +1,37 @@
+#include "Generator/Transform.h"
+
+#include "Board/Board.h"
+#include "Solver/Solver.h"
+
+#include <gtest/gtest.h>
+#include <random>
+
+static char const SOLVED_BOARD_STRING[] = "524189637361547289879623145653498712987251364142376958238914576415762893796835421";
+static char const PUZZLE_STRING[]       = "060000708000081500908000000006000900103002000200300070001000060020050400870009001";
+
+TEST(Transform, Transform)
+{
+    Board board(SOLVED_BOARD_STRING);
+    Board transformed = Transform().apply(board);
+    EXPECT_EQ(transformed.cells(), board.cells());
+}
+
+TEST(Transform, random)
+{
+    std::mt19937 rng(1);
+    Board        solved(SOLVED_BOARD_STRING);
+    Board        puzzle(PUZZLE_STRING);
+    for (int i = 0; i < 10; ++i)
+    {
+        Transform t = Transform::random(rng);
+        EXPECT_TRUE(t.apply(solved).solved());
+        EXPECT_TRUE(Solver::hasUniqueSolution(t.apply(puzzle)));
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    int rv = RUN_ALL_TESTS();
+    return rv;
+}